@@ -0,0 +1,151 @@
+#include "s21_allocator.h"
+
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "s21_matrix_error.h"
+
+namespace {
+
+// Лежит прямо перед блоком, который получает пользователь
+struct BufferHeader {
+  void *base;
+  // Размер отображения для mmap или выравнивание для блока из кучи
+  size_t size;
+  bool mapped;
+};
+
+const size_t kHugePageSize = 2 << 20;
+
+std::mutex policy_mutex;
+S21AllocationPolicy current_policy;
+
+size_t RoundUp(size_t value, size_t step) {
+  return (value + step - 1) / step * step;
+}
+
+#ifdef __linux__
+
+// Режимы mbind из numaif.h, чтобы не зависеть от libnuma
+const int kMpolBind = 2;
+const int kMpolInterleave = 3;
+
+void Place(void *base, size_t size, const S21AllocationPolicy &policy) {
+  if (policy.huge_pages == S21HugePages::kTransparent) {
+    madvise(base, size, MADV_HUGEPAGE);
+  }
+  if (policy.placement == S21NumaPlacement::kFirstTouch) {
+    return;
+  }
+  unsigned long mask[16] = {0};
+  int mode = kMpolInterleave;
+  if (policy.placement == S21NumaPlacement::kInterleave) {
+    for (unsigned long &word : mask) word = ~0UL;
+  } else {
+    if (policy.numa_node < 0 || policy.numa_node >= 16 * 64) {
+      return;
+    }
+    mode = kMpolBind;
+    mask[policy.numa_node / 64] = 1UL << (policy.numa_node % 64);
+  }
+  // Без NUMA ядро вернет ошибку — тогда остается обычное размещение
+  syscall(SYS_mbind, base, size, mode, mask, 16 * 64, 0);
+}
+
+double *AllocateMapped(size_t bytes, const S21AllocationPolicy &policy) {
+  size_t page = sysconf(_SC_PAGESIZE);
+  size_t offset = RoundUp(sizeof(BufferHeader), policy.alignment);
+  void *base = MAP_FAILED;
+  size_t size = 0;
+  if (policy.huge_pages == S21HugePages::kExplicit) {
+    size = RoundUp(offset + bytes, kHugePageSize);
+    base = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  }
+  if (base == MAP_FAILED) {
+    size_t step = policy.huge_pages == S21HugePages::kNone ? page
+                                                           : kHugePageSize;
+    size = RoundUp(offset + bytes, step);
+    // Берем с запасом и обрезаем края, чтобы начало легло на границу step
+    size_t reserved = size + step;
+    char *raw = (char *)mmap(nullptr, reserved, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+      throw std::bad_alloc();
+    }
+    char *aligned = (char *)RoundUp((uintptr_t)raw, step);
+    if (aligned != raw) {
+      munmap(raw, aligned - raw);
+    }
+    size_t tail = reserved - (aligned - raw) - size;
+    if (tail != 0) {
+      munmap(aligned + size, tail);
+    }
+    base = aligned;
+  }
+  Place(base, size, policy);
+  BufferHeader *header =
+      (BufferHeader *)((char *)base + offset - sizeof(BufferHeader));
+  *header = {base, size, true};
+  return (double *)((char *)base + offset);
+}
+
+#endif
+
+}  // namespace
+
+void S21SetAllocationPolicy(const S21AllocationPolicy &policy) {
+  if (policy.alignment < alignof(BufferHeader) ||
+      (policy.alignment & (policy.alignment - 1)) != 0) {
+    throw S21ArgumentError("Invalid alignment");
+  }
+  std::lock_guard<std::mutex> lock(policy_mutex);
+  current_policy = policy;
+}
+
+S21AllocationPolicy S21GetAllocationPolicy() {
+  std::lock_guard<std::mutex> lock(policy_mutex);
+  return current_policy;
+}
+
+double *S21AllocateBuffer(size_t count) {
+  if (count == 0) {
+    return nullptr;
+  }
+  S21AllocationPolicy policy = S21GetAllocationPolicy();
+  size_t bytes = count * sizeof(double);
+#ifdef __linux__
+  if (bytes >= policy.map_threshold &&
+      (policy.huge_pages != S21HugePages::kNone ||
+       policy.placement != S21NumaPlacement::kFirstTouch)) {
+    return AllocateMapped(bytes, policy);
+  }
+#endif
+  size_t offset = RoundUp(sizeof(BufferHeader), policy.alignment);
+  char *base = (char *)::operator new(offset + bytes,
+                                      std::align_val_t(policy.alignment));
+  BufferHeader *header = (BufferHeader *)(base + offset - sizeof(BufferHeader));
+  *header = {base, policy.alignment, false};
+  return (double *)(base + offset);
+}
+
+void S21FreeBuffer(double *data) {
+  if (data == nullptr) {
+    return;
+  }
+  BufferHeader *header = (BufferHeader *)data - 1;
+#ifdef __linux__
+  if (header->mapped) {
+    munmap(header->base, header->size);
+    return;
+  }
+#endif
+  ::operator delete(header->base, std::align_val_t(header->size));
+}
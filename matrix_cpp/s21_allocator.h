@@ -0,0 +1,47 @@
+#ifndef S21_ALLOCATOR_H
+#define S21_ALLOCATOR_H
+
+#include <cstddef>
+
+// Как выделять память под элементы матриц
+enum class S21HugePages {
+  kNone,
+  // Прозрачные большие страницы: блок выравнивается на 2 МБ и помечается
+  // madvise(MADV_HUGEPAGE)
+  kTransparent,
+  // Явные большие страницы (MAP_HUGETLB); если их нет в системе, выделяются
+  // обычные страницы
+  kExplicit
+};
+
+enum class S21NumaPlacement {
+  // Страница попадает на узел потока, который первым в нее пишет
+  kFirstTouch,
+  // Страницы чередуются между всеми узлами
+  kInterleave,
+  // Все страницы на узле numa_node
+  kBind
+};
+
+struct S21AllocationPolicy {
+  // Выравнивание начала блока, степень двойки не меньше 8
+  size_t alignment = 64;
+  S21HugePages huge_pages = S21HugePages::kNone;
+  S21NumaPlacement placement = S21NumaPlacement::kFirstTouch;
+  int numa_node = 0;
+  // Блоки меньше этого размера берутся из обычной кучи, большие — через mmap,
+  // чтобы к ним можно было применить huge_pages и placement
+  size_t map_threshold = 1 << 21;
+};
+
+// Политика действует на все последующие выделения памяти матрицами
+void S21SetAllocationPolicy(const S21AllocationPolicy &policy);
+S21AllocationPolicy S21GetAllocationPolicy();
+
+// Выделяет выровненный блок под count чисел. Содержимое не обнулено: первую
+// запись делает владелец, чтобы страницы легли на узлы NUMA тех потоков,
+// которые потом будут с ними работать
+double *S21AllocateBuffer(size_t count);
+void S21FreeBuffer(double *data);
+
+#endif
@@ -0,0 +1,459 @@
+#include "s21_distributed.h"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <utility>
+
+namespace {
+
+// Сообщение в сокете: число элементов (uint64_t), затем сами элементы
+struct Outgoing {
+  uint64_t count;
+  const std::vector<double> *message;
+  size_t done = 0;
+
+  size_t Total() const { return sizeof(count) + count * sizeof(double); }
+  const char *Position() const {
+    if (done < sizeof(count)) {
+      return reinterpret_cast<const char *>(&count) + done;
+    }
+    return reinterpret_cast<const char *>(message->data()) + done -
+           sizeof(count);
+  }
+  size_t Chunk() const {
+    return done < sizeof(count) ? sizeof(count) - done : Total() - done;
+  }
+};
+
+struct Incoming {
+  uint64_t count = 0;
+  std::vector<double> message;
+  size_t done = 0;
+
+  size_t Total() const { return sizeof(count) + count * sizeof(double); }
+  char *Position() {
+    if (done < sizeof(count)) return reinterpret_cast<char *>(&count) + done;
+    return reinterpret_cast<char *>(message.data()) + done - sizeof(count);
+  }
+  size_t Chunk() const {
+    return done < sizeof(count) ? sizeof(count) - done : Total() - done;
+  }
+};
+
+// Передает out в сокет out_fd и принимает сообщение из in_fd; любой из
+// сокетов может быть -1. Обе стороны продвигаются по готовности, поэтому
+// встречные передачи не ждут друг друга
+void Transfer(int out_fd, Outgoing *out, int in_fd, Incoming *in) {
+  bool sending = out_fd >= 0;
+  bool receiving = in_fd >= 0;
+  while (sending || receiving) {
+    pollfd fds[2];
+    int count = 0;
+    if (sending) fds[count++] = {out_fd, POLLOUT, 0};
+    if (receiving) fds[count++] = {in_fd, POLLIN, 0};
+    if (poll(fds, count, -1) < 0) {
+      if (errno == EINTR) continue;
+      throw S21SystemError("Transport error");
+    }
+    for (int i = 0; i < count; i++) {
+      if (fds[i].revents == 0) continue;
+      if (sending && fds[i].fd == out_fd && (fds[i].revents & POLLOUT)) {
+        ssize_t written = send(out_fd, out->Position(), out->Chunk(),
+                               MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (written < 0 && errno != EAGAIN && errno != EINTR) {
+          throw S21SystemError("Transport error");
+        }
+        if (written > 0) out->done += written;
+        sending = out->done < out->Total();
+      } else if (receiving && fds[i].fd == in_fd) {
+        ssize_t read = recv(in_fd, in->Position(), in->Chunk(), MSG_DONTWAIT);
+        if (read == 0) throw S21SystemError("Connection closed");
+        if (read < 0 && errno != EAGAIN && errno != EINTR) {
+          throw S21SystemError("Transport error");
+        }
+        if (read > 0) in->done += read;
+        if (in->done == sizeof(in->count)) in->message.resize(in->count);
+        receiving = in->done < in->Total();
+      } else if (fds[i].revents & (POLLERR | POLLHUP | POLLNVAL)) {
+        throw S21SystemError("Connection closed");
+      }
+    }
+  }
+}
+
+// Решетка rows x cols из size процессов, наиболее близкая к квадратной
+std::pair<int, int> GridShape(int size) {
+  int rows = static_cast<int>(sqrt(static_cast<double>(size)));
+  while (size % rows) rows--;
+  return {rows, size / rows};
+}
+
+// Число индексов из n, принадлежащих координате решетки index при
+// циклическом распределении блоков по parts координатам
+int OwnedCount(int n, int block, int index, int parts) {
+  int blocks = n / block;
+  int count = (blocks / parts) * block;
+  int extra = blocks % parts;
+  if (index < extra) {
+    count += block;
+  } else if (index == extra) {
+    count += n % block;
+  }
+  return count;
+}
+
+int ToGlobal(int local, int block, int index, int parts) {
+  return ((local / block) * parts + index) * block + local % block;
+}
+
+int ToLocal(int global, int block, int parts) {
+  return (global / block / parts) * block + global % block;
+}
+
+}  // namespace
+
+S21SocketTransport::S21SocketTransport(int rank,
+                                       const std::vector<int> &sockets)
+    : rank_(rank), sockets_(sockets) {
+  if (rank < 0 || rank >= static_cast<int>(sockets.size())) {
+    throw S21ArgumentError("Invalid rank");
+  }
+}
+
+S21SocketTransport::~S21SocketTransport() {
+  for (int i = 0; i < GetSize(); i++) {
+    if (i != rank_ && sockets_[i] >= 0) close(sockets_[i]);
+  }
+}
+
+int S21SocketTransport::GetRank() const { return rank_; }
+
+int S21SocketTransport::GetSize() const {
+  return static_cast<int>(sockets_.size());
+}
+
+void S21SocketTransport::Send(int to, const std::vector<double> &message) {
+  if (to < 0 || to >= GetSize() || to == rank_) {
+    throw S21ArgumentError("Invalid rank");
+  }
+  Outgoing out = {message.size(), &message};
+  Transfer(sockets_[to], &out, -1, nullptr);
+}
+
+std::vector<double> S21SocketTransport::Receive(int from) {
+  if (from < 0 || from >= GetSize() || from == rank_) {
+    throw S21ArgumentError("Invalid rank");
+  }
+  Incoming in;
+  Transfer(-1, nullptr, sockets_[from], &in);
+  return std::move(in.message);
+}
+
+std::vector<double> S21SocketTransport::SendReceive(
+    int to, const std::vector<double> &message, int from) {
+  if (to < 0 || to >= GetSize() || to == rank_ || from < 0 ||
+      from >= GetSize() || from == rank_) {
+    throw S21ArgumentError("Invalid rank");
+  }
+  Outgoing out = {message.size(), &message};
+  Incoming in;
+  Transfer(sockets_[to], &out, sockets_[from], &in);
+  return std::move(in.message);
+}
+
+void S21RunWorkers(int processes,
+                   const std::function<void(S21Transport &)> &worker) {
+  if (processes < 1) throw S21ArgumentError("Invalid process count");
+  // sockets[i][j] — конец пары, принадлежащий процессу i, для связи с j
+  std::vector<std::vector<int>> sockets(processes,
+                                        std::vector<int>(processes, -1));
+  auto close_all = [&](int keep) {
+    for (int i = 0; i < processes; i++) {
+      for (int j = 0; j < processes; j++) {
+        if (i != keep && sockets[i][j] >= 0) close(sockets[i][j]);
+      }
+    }
+  };
+  for (int i = 0; i < processes; i++) {
+    for (int j = i + 1; j < processes; j++) {
+      int pair[2];
+      if (socketpair(AF_UNIX, SOCK_STREAM, 0, pair) != 0) {
+        close_all(-1);
+        throw S21SystemError("Cannot create sockets");
+      }
+      sockets[i][j] = pair[0];
+      sockets[j][i] = pair[1];
+    }
+  }
+  // Иначе буферы вывода продублируются в дочерних процессах
+  fflush(nullptr);
+  std::vector<pid_t> children;
+  for (int rank = 1; rank < processes; rank++) {
+    pid_t child = fork();
+    if (child < 0) break;
+    if (child == 0) {
+      close_all(rank);
+      int status = 0;
+      try {
+        S21SocketTransport transport(rank, sockets[rank]);
+        worker(transport);
+      } catch (...) {
+        status = 1;
+      }
+      _exit(status);
+    }
+    children.push_back(child);
+  }
+  close_all(0);
+  bool failed = static_cast<int>(children.size()) != processes - 1;
+  std::exception_ptr error;
+  if (failed) {
+    // Без полного набора процессов работа невозможна; закрытие сокетов
+    // разбудит уже запущенные процессы
+    for (int j = 0; j < processes; j++) {
+      if (sockets[0][j] >= 0) close(sockets[0][j]);
+    }
+  } else {
+    try {
+      S21SocketTransport transport(0, sockets[0]);
+      worker(transport);
+    } catch (...) {
+      error = std::current_exception();
+    }
+  }
+  for (pid_t child : children) {
+    int status = 0;
+    while (waitpid(child, &status, 0) < 0 && errno == EINTR) {
+    }
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) failed = true;
+  }
+  if (error) std::rethrow_exception(error);
+  if (failed) throw S21SystemError("Worker process failed");
+}
+
+S21DistributedMatrix::S21DistributedMatrix(S21Transport &transport, int rows,
+                                           int cols, int block_size)
+    : transport_(&transport),
+      rows_(rows),
+      cols_(cols),
+      block_size_(block_size) {
+  if (rows < 1 || cols < 1) throw S21SizeError("Invalid matrix size");
+  if (block_size < 1) throw S21ArgumentError("Invalid block size");
+  std::pair<int, int> grid = GridShape(transport.GetSize());
+  grid_rows_ = grid.first;
+  grid_cols_ = grid.second;
+  grid_row_ = transport.GetRank() / grid_cols_;
+  grid_col_ = transport.GetRank() % grid_cols_;
+  local_.Resize(LocalRows(grid_row_), LocalCols(grid_col_));
+}
+
+S21DistributedMatrix S21DistributedMatrix::Scatter(S21Transport &transport,
+                                                   const S21Matrix &global,
+                                                   int block_size) {
+  int rank = transport.GetRank();
+  std::vector<double> shape = {static_cast<double>(global.GetRows()),
+                               static_cast<double>(global.GetCols())};
+  for (int i = 1; i < transport.GetSize(); i++) {
+    if (rank == 0) {
+      transport.Send(i, shape);
+    } else if (rank == i) {
+      shape = transport.Receive(0);
+    }
+  }
+  S21DistributedMatrix result(transport, static_cast<int>(shape[0]),
+                              static_cast<int>(shape[1]), block_size);
+  if (rank != 0) {
+    std::vector<double> local = transport.Receive(0);
+    if (!local.empty()) result.local_.Assign(local.data());
+    return result;
+  }
+  for (int i = 0; i < transport.GetSize(); i++) {
+    int grid_row = i / result.grid_cols_;
+    int grid_col = i % result.grid_cols_;
+    int local_rows = result.LocalRows(grid_row);
+    int local_cols = result.LocalCols(grid_col);
+    std::vector<double> local;
+    local.reserve(static_cast<size_t>(local_rows) * local_cols);
+    for (int li = 0; li < local_rows; li++) {
+      const double *row = global.GetRowData(
+          ToGlobal(li, block_size, grid_row, result.grid_rows_));
+      for (int lj = 0; lj < local_cols; lj++) {
+        local.push_back(
+            row[ToGlobal(lj, block_size, grid_col, result.grid_cols_)]);
+      }
+    }
+    if (i != 0) {
+      transport.Send(i, local);
+    } else if (!local.empty()) {
+      result.local_.Assign(local.data());
+    }
+  }
+  return result;
+}
+
+S21Matrix S21DistributedMatrix::Gather() const {
+  int rank = transport_->GetRank();
+  if (rank != 0) {
+    std::vector<double> local(static_cast<size_t>(local_.GetRows()) *
+                              local_.GetCols());
+    if (!local.empty()) local_.CopyTo(local.data());
+    transport_->Send(0, local);
+    return S21Matrix();
+  }
+  S21Matrix result(rows_, cols_);
+  for (int i = 0; i < transport_->GetSize(); i++) {
+    int grid_row = i / grid_cols_;
+    int grid_col = i % grid_cols_;
+    int local_rows = LocalRows(grid_row);
+    int local_cols = LocalCols(grid_col);
+    std::vector<double> local;
+    if (i == 0) {
+      local.resize(static_cast<size_t>(local_rows) * local_cols);
+      if (!local.empty()) local_.CopyTo(local.data());
+    } else {
+      local = transport_->Receive(i);
+    }
+    for (int li = 0; li < local_rows; li++) {
+      double *row =
+          result.GetRowData(ToGlobal(li, block_size_, grid_row, grid_rows_));
+      for (int lj = 0; lj < local_cols; lj++) {
+        row[ToGlobal(lj, block_size_, grid_col, grid_cols_)] =
+            local[static_cast<size_t>(li) * local_cols + lj];
+      }
+    }
+  }
+  return result;
+}
+
+int S21DistributedMatrix::GetRows() const { return rows_; }
+
+int S21DistributedMatrix::GetCols() const { return cols_; }
+
+int S21DistributedMatrix::GetBlockSize() const { return block_size_; }
+
+int S21DistributedMatrix::GetGridRows() const { return grid_rows_; }
+
+int S21DistributedMatrix::GetGridCols() const { return grid_cols_; }
+
+int S21DistributedMatrix::Owner(int row, int col) const {
+  if (row < 0 || row >= rows_ || col < 0 || col >= cols_) {
+    throw S21IndexError("Index out of range");
+  }
+  return (row / block_size_ % grid_rows_) * grid_cols_ +
+         col / block_size_ % grid_cols_;
+}
+
+S21Matrix &S21DistributedMatrix::GetLocal() { return local_; }
+
+const S21Matrix &S21DistributedMatrix::GetLocal() const { return local_; }
+
+S21DistributedMatrix S21DistributedMatrix::Transpose() const {
+  S21DistributedMatrix result(*transport_, cols_, rows_, block_size_);
+  int size = transport_->GetSize();
+  int rank = transport_->GetRank();
+  // Элементы уходят по столбцам a, а принимаются по строкам результата:
+  // оба обхода идут в одном порядке глобальных индексов, поэтому позиции
+  // передавать не нужно
+  std::vector<std::vector<double>> outgoing(size);
+  for (int lj = 0; lj < local_.GetCols(); lj++) {
+    int j = ToGlobal(lj, block_size_, grid_col_, grid_cols_);
+    for (int li = 0; li < local_.GetRows(); li++) {
+      int i = ToGlobal(li, block_size_, grid_row_, grid_rows_);
+      outgoing[result.Owner(j, i)].push_back(local_.GetRowData(li)[lj]);
+    }
+  }
+  std::vector<std::vector<double>> incoming(size);
+  incoming[rank] = std::move(outgoing[rank]);
+  for (int step = 1; step < size; step++) {
+    int to = (rank + step) % size;
+    int from = (rank - step + size) % size;
+    incoming[from] = transport_->SendReceive(to, outgoing[to], from);
+  }
+  std::vector<size_t> position(size);
+  for (int li = 0; li < result.local_.GetRows(); li++) {
+    int r = ToGlobal(li, block_size_, grid_row_, grid_rows_);
+    double *row = result.local_.GetRowData(li);
+    for (int lj = 0; lj < result.local_.GetCols(); lj++) {
+      int c = ToGlobal(lj, block_size_, grid_col_, grid_cols_);
+      int source = Owner(c, r);
+      row[lj] = incoming[source][position[source]++];
+    }
+  }
+  return result;
+}
+
+int S21DistributedMatrix::LocalRows(int grid_row) const {
+  return OwnedCount(rows_, block_size_, grid_row, grid_rows_);
+}
+
+int S21DistributedMatrix::LocalCols(int grid_col) const {
+  return OwnedCount(cols_, block_size_, grid_col, grid_cols_);
+}
+
+void Multiply(S21DistributedMatrix &out, const S21DistributedMatrix &a,
+              const S21DistributedMatrix &b) {
+  if (a.transport_ != b.transport_ || a.block_size_ != b.block_size_) {
+    throw S21SizeError("Matrices are distributed differently");
+  }
+  if (a.cols_ != b.rows_) throw S21SizeError("Wrong matrix size");
+  S21Transport &transport = *a.transport_;
+  int block = a.block_size_;
+  S21DistributedMatrix result(transport, a.rows_, b.cols_, block);
+  int local_rows = a.local_.GetRows();
+  int local_cols = b.local_.GetCols();
+  int steps = (a.cols_ + block - 1) / block;
+  for (int k = 0; k < steps; k++) {
+    int width = std::min(block, a.cols_ - k * block);
+    // Блочный столбец k матрицы a рассылается вдоль строки решетки
+    int a_owner = k % a.grid_cols_;
+    std::vector<double> a_panel;
+    if (a.grid_col_ == a_owner) {
+      int offset = ToLocal(k * block, block, a.grid_cols_);
+      a_panel.reserve(static_cast<size_t>(local_rows) * width);
+      for (int li = 0; li < local_rows; li++) {
+        const double *row = a.local_.GetRowData(li) + offset;
+        a_panel.insert(a_panel.end(), row, row + width);
+      }
+      for (int col = 0; col < a.grid_cols_; col++) {
+        if (col != a_owner) {
+          transport.Send(a.grid_row_ * a.grid_cols_ + col, a_panel);
+        }
+      }
+    } else {
+      a_panel = transport.Receive(a.grid_row_ * a.grid_cols_ + a_owner);
+    }
+    // Блочная строка k матрицы b — вдоль столбца решетки
+    int b_owner = k % b.grid_rows_;
+    std::vector<double> b_panel;
+    if (b.grid_row_ == b_owner) {
+      int offset = ToLocal(k * block, block, b.grid_rows_);
+      b_panel.reserve(static_cast<size_t>(width) * local_cols);
+      for (int li = 0; li < width; li++) {
+        const double *row = b.local_.GetRowData(offset + li);
+        b_panel.insert(b_panel.end(), row, row + local_cols);
+      }
+      for (int row = 0; row < b.grid_rows_; row++) {
+        if (row != b_owner) {
+          transport.Send(row * b.grid_cols_ + b.grid_col_, b_panel);
+        }
+      }
+    } else {
+      b_panel = transport.Receive(b_owner * b.grid_cols_ + b.grid_col_);
+    }
+    if (local_rows > 0 && local_cols > 0) {
+      S21Matrix a_block(local_rows, width, a_panel.data());
+      S21Matrix b_block(width, local_cols, b_panel.data());
+      Multiply(result.local_, a_block, b_block, 1.0, 1.0);
+    }
+  }
+  out = std::move(result);
+}
@@ -0,0 +1,109 @@
+#ifndef S21_DISTRIBUTED_H
+#define S21_DISTRIBUTED_H
+
+#include <functional>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Канал между процессами с номерами 0..GetSize()-1. Сообщения между парой
+// процессов доставляются в порядке отправки
+class S21Transport {
+ public:
+  virtual ~S21Transport() = default;
+  virtual int GetRank() const = 0;
+  virtual int GetSize() const = 0;
+  virtual void Send(int to, const std::vector<double> &message) = 0;
+  virtual std::vector<double> Receive(int from) = 0;
+  // Отправка и прием одновременно: не блокируется, когда получатель в это
+  // же время отправляет встречное сообщение
+  virtual std::vector<double> SendReceive(int to,
+                                          const std::vector<double> &message,
+                                          int from) = 0;
+};
+
+// Транспорт поверх локальных Unix-сокетов: sockets[i] соединен с
+// процессом i, sockets[rank] не используется. Закрывает сокеты при
+// уничтожении
+class S21SocketTransport : public S21Transport {
+ public:
+  S21SocketTransport(int rank, const std::vector<int> &sockets);
+  S21SocketTransport(const S21SocketTransport &other) = delete;
+  ~S21SocketTransport() override;
+  S21SocketTransport &operator=(const S21SocketTransport &other) = delete;
+
+  int GetRank() const override;
+  int GetSize() const override;
+  void Send(int to, const std::vector<double> &message) override;
+  std::vector<double> Receive(int from) override;
+  std::vector<double> SendReceive(int to, const std::vector<double> &message,
+                                  int from) override;
+
+ private:
+  int rank_;
+  std::vector<int> sockets_;
+};
+
+// Запускает processes процессов, соединенных S21SocketTransport, и
+// выполняет в каждом worker. Вызывающий процесс получает номер 0, остальные
+// порождаются fork и завершаются после worker. Возвращает управление, когда
+// все процессы закончили; бросает исключение, если хотя бы один упал.
+// Пул потоков в дочернем процессе начинает с пустой очереди: задачи,
+// поставленные родителем до fork, там не выполняются
+void S21RunWorkers(int processes,
+                   const std::function<void(S21Transport &)> &worker);
+
+// Матрица, распределенная блочно-циклически по решетке процессов
+// GetGridRows() x GetGridCols(): блок (bi, bj) размера block_size хранит
+// процесс (bi % GetGridRows(), bj % GetGridCols()) с номером
+// строка_решетки * GetGridCols() + столбец_решетки. Локальные блоки
+// процесса лежат подряд в GetLocal(). Все операции коллективные: их
+// вызывают все процессы транспорта в одном порядке
+class S21DistributedMatrix {
+ public:
+  S21DistributedMatrix(S21Transport &transport, int rows, int cols,
+                       int block_size);
+
+  // Раздает матрицу global процесса 0; у остальных global не читается
+  static S21DistributedMatrix Scatter(S21Transport &transport,
+                                      const S21Matrix &global, int block_size);
+  // Собирает матрицу в процессе 0; остальные получают пустую матрицу
+  S21Matrix Gather() const;
+
+  int GetRows() const;
+  int GetCols() const;
+  int GetBlockSize() const;
+  int GetGridRows() const;
+  int GetGridCols() const;
+  // Номер процесса, хранящего элемент (row, col)
+  int Owner(int row, int col) const;
+  S21Matrix &GetLocal();
+  const S21Matrix &GetLocal() const;
+
+  S21DistributedMatrix Transpose() const;
+
+  // Алгоритм SUMMA: на шаге k строки решетки рассылают k-й блочный столбец
+  // a, столбцы решетки — k-ю блочную строку b, и каждый процесс добавляет
+  // их произведение к своей части out
+  friend void Multiply(S21DistributedMatrix &out, const S21DistributedMatrix &a,
+                       const S21DistributedMatrix &b);
+
+ private:
+  S21Transport *transport_;
+  int rows_;
+  int cols_;
+  int block_size_;
+  int grid_rows_;
+  int grid_cols_;
+  int grid_row_;
+  int grid_col_;
+  S21Matrix local_;
+
+  int LocalRows(int grid_row) const;
+  int LocalCols(int grid_col) const;
+};
+
+void Multiply(S21DistributedMatrix &out, const S21DistributedMatrix &a,
+              const S21DistributedMatrix &b);
+
+#endif
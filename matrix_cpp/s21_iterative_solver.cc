@@ -0,0 +1,342 @@
+#include "s21_iterative_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "s21_thread_pool.h"
+#include "s21_tuning.h"
+
+namespace {
+
+double VecDot(const std::vector<double> &x, const std::vector<double> &y) {
+  double result = 0;
+  for (size_t i = 0; i < x.size(); i++) result += x[i] * y[i];
+  return result;
+}
+
+double VecNorm(const std::vector<double> &x) { return sqrt(VecDot(x, x)); }
+
+// y += alpha * x
+void VecAxpy(double alpha, const std::vector<double> &x,
+             std::vector<double> &y) {
+  for (size_t i = 0; i < x.size(); i++) y[i] += alpha * x[i];
+}
+
+void Precondition(const S21SolverOptions &options, const std::vector<double> &r,
+                  std::vector<double> &z) {
+  if (options.preconditioner) {
+    options.preconditioner->Apply(r.data(), z.data());
+  } else {
+    z = r;
+  }
+}
+
+// Общая подготовка: проверка размеров, начальное приближение, r = b - A * x
+struct SolverState {
+  std::vector<double> b;
+  std::vector<double> x;
+  std::vector<double> r;
+  double b_norm;
+};
+
+SolverState Prepare(const S21LinearOperator &a, const S21Matrix &b,
+                    const S21Matrix &x, const S21SolverOptions &options) {
+  int n = a.GetSize();
+  if (b.GetRows() != n || b.GetCols() != 1) {
+    throw S21SizeError("Incorrect matrix size");
+  }
+  if (options.tolerance < 0 || options.max_iterations < 0 ||
+      options.restart < 1) {
+    throw S21ArgumentError("Invalid solver options");
+  }
+  SolverState state;
+  state.b.resize(n);
+  b.CopyTo(state.b.data());
+  state.x.assign(n, 0);
+  if (x.GetRows() == n && x.GetCols() == 1) x.CopyTo(state.x.data());
+  state.r.resize(n);
+  a.Apply(state.x.data(), state.r.data());
+  for (int i = 0; i < n; i++) state.r[i] = state.b[i] - state.r[i];
+  state.b_norm = VecNorm(state.b);
+  return state;
+}
+
+double Relative(double residual, double b_norm) {
+  return b_norm > 0 ? residual / b_norm : residual;
+}
+
+S21SolverStats Finish(SolverState &state, S21Matrix &x, int iterations,
+                      std::vector<double> &history, double tolerance) {
+  int n = static_cast<int>(state.x.size());
+  if (x.GetRows() != n || x.GetCols() != 1) x = S21Matrix(n, 1);
+  x.Assign(state.x.data());
+  double residual = history.back();
+  return {residual <= tolerance, iterations, residual, std::move(history)};
+}
+
+}  // namespace
+
+S21MatrixOperator::S21MatrixOperator(const S21Matrix &matrix)
+    : matrix_(matrix) {
+  if (matrix.GetRows() != matrix.GetCols()) {
+    throw S21SizeError("Matrix is not square");
+  }
+}
+
+int S21MatrixOperator::GetSize() const { return matrix_.GetRows(); }
+
+void S21MatrixOperator::Apply(const double *x, double *y) const {
+  int n = matrix_.GetRows();
+  int grain = std::max(1, S21GetTuning().parallel_elements / std::max(1, n));
+  S21ThreadPool::Instance().ParallelFor(0, n, grain, [&](int from, int to) {
+    for (int i = from; i < to; i++) {
+      const double *row = matrix_.GetRowData(i);
+      double sum = 0;
+      for (int j = 0; j < n; j++) sum += row[j] * x[j];
+      y[i] = sum;
+    }
+  });
+}
+
+S21FunctionOperator::S21FunctionOperator(
+    int size, std::function<void(const double *, double *)> apply)
+    : size_(size), apply_(std::move(apply)) {
+  if (size < 1 || !apply_) throw S21ArgumentError("Invalid operator");
+}
+
+int S21FunctionOperator::GetSize() const { return size_; }
+
+void S21FunctionOperator::Apply(const double *x, double *y) const {
+  apply_(x, y);
+}
+
+S21JacobiPreconditioner::S21JacobiPreconditioner(const S21Matrix &matrix) {
+  if (matrix.GetRows() != matrix.GetCols()) {
+    throw S21SizeError("Matrix is not square");
+  }
+  inverse_diagonal_.resize(matrix.GetRows());
+  for (int i = 0; i < matrix.GetRows(); i++) {
+    double value = matrix.GetRowData(i)[i];
+    if (value == 0) throw S21SingularError("Zero diagonal element");
+    inverse_diagonal_[i] = 1 / value;
+  }
+}
+
+void S21JacobiPreconditioner::Apply(const double *r, double *z) const {
+  for (size_t i = 0; i < inverse_diagonal_.size(); i++) {
+    z[i] = r[i] * inverse_diagonal_[i];
+  }
+}
+
+S21ILU0Preconditioner::S21ILU0Preconditioner(const S21Matrix &matrix)
+    : size_(matrix.GetRows()) {
+  if (matrix.GetRows() != matrix.GetCols()) {
+    throw S21SizeError("Matrix is not square");
+  }
+  row_start_.assign(1, 0);
+  diagonal_.assign(size_, -1);
+  for (int i = 0; i < size_; i++) {
+    const double *row = matrix.GetRowData(i);
+    for (int j = 0; j < size_; j++) {
+      if (row[j] == 0) continue;
+      if (i == j) diagonal_[i] = static_cast<int>(columns_.size());
+      columns_.push_back(j);
+      values_.push_back(row[j]);
+    }
+    if (diagonal_[i] < 0) throw S21SingularError("Zero diagonal element");
+    row_start_.push_back(static_cast<int>(columns_.size()));
+  }
+  // Позиция столбца j в текущей строке или -1, если его нет в шаблоне
+  std::vector<int> position(size_, -1);
+  for (int i = 0; i < size_; i++) {
+    for (int p = row_start_[i]; p < row_start_[i + 1]; p++) {
+      position[columns_[p]] = p;
+    }
+    for (int p = row_start_[i]; p < diagonal_[i]; p++) {
+      int k = columns_[p];
+      double pivot = values_[diagonal_[k]];
+      if (pivot == 0) throw S21SingularError("Zero pivot");
+      values_[p] /= pivot;
+      for (int q = diagonal_[k] + 1; q < row_start_[k + 1]; q++) {
+        int target = position[columns_[q]];
+        if (target >= 0) values_[target] -= values_[p] * values_[q];
+      }
+    }
+    if (values_[diagonal_[i]] == 0) throw S21SingularError("Zero pivot");
+    for (int p = row_start_[i]; p < row_start_[i + 1]; p++) {
+      position[columns_[p]] = -1;
+    }
+  }
+}
+
+void S21ILU0Preconditioner::Apply(const double *r, double *z) const {
+  for (int i = 0; i < size_; i++) {
+    double sum = r[i];
+    for (int p = row_start_[i]; p < diagonal_[i]; p++) {
+      sum -= values_[p] * z[columns_[p]];
+    }
+    z[i] = sum;
+  }
+  for (int i = size_ - 1; i >= 0; i--) {
+    double sum = z[i];
+    for (int p = diagonal_[i] + 1; p < row_start_[i + 1]; p++) {
+      sum -= values_[p] * z[columns_[p]];
+    }
+    z[i] = sum / values_[diagonal_[i]];
+  }
+}
+
+S21SolverStats SolveCG(const S21LinearOperator &a, const S21Matrix &b,
+                       S21Matrix &x, const S21SolverOptions &options) {
+  SolverState state = Prepare(a, b, x, options);
+  int n = a.GetSize();
+  std::vector<double> &r = state.r;
+  std::vector<double> history = {Relative(VecNorm(r), state.b_norm)};
+  std::vector<double> z(n), p(n), ap(n);
+  Precondition(options, r, z);
+  p = z;
+  double rz = VecDot(r, z);
+  int iteration = 0;
+  while (history.back() > options.tolerance &&
+         iteration < options.max_iterations) {
+    a.Apply(p.data(), ap.data());
+    double curvature = VecDot(p, ap);
+    if (curvature == 0) break;
+    double alpha = rz / curvature;
+    VecAxpy(alpha, p, state.x);
+    VecAxpy(-alpha, ap, r);
+    iteration++;
+    history.push_back(Relative(VecNorm(r), state.b_norm));
+    Precondition(options, r, z);
+    double rz_next = VecDot(r, z);
+    double beta = rz_next / rz;
+    rz = rz_next;
+    for (int i = 0; i < n; i++) p[i] = z[i] + beta * p[i];
+  }
+  return Finish(state, x, iteration, history, options.tolerance);
+}
+
+S21SolverStats SolveBiCGSTAB(const S21LinearOperator &a, const S21Matrix &b,
+                             S21Matrix &x, const S21SolverOptions &options) {
+  SolverState state = Prepare(a, b, x, options);
+  int n = a.GetSize();
+  std::vector<double> &r = state.r;
+  std::vector<double> history = {Relative(VecNorm(r), state.b_norm)};
+  std::vector<double> r_hat = r, p(n, 0), v(n, 0), y(n), s(n), z(n), t(n);
+  double rho = 1, alpha = 1, omega = 1;
+  int iteration = 0;
+  while (history.back() > options.tolerance &&
+         iteration < options.max_iterations) {
+    double rho_next = VecDot(r_hat, r);
+    if (rho_next == 0) break;
+    double beta = (rho_next / rho) * (alpha / omega);
+    rho = rho_next;
+    for (int i = 0; i < n; i++) p[i] = r[i] + beta * (p[i] - omega * v[i]);
+    Precondition(options, p, y);
+    a.Apply(y.data(), v.data());
+    double r_hat_v = VecDot(r_hat, v);
+    if (r_hat_v == 0) break;
+    alpha = rho / r_hat_v;
+    for (int i = 0; i < n; i++) s[i] = r[i] - alpha * v[i];
+    VecAxpy(alpha, y, state.x);
+    iteration++;
+    double s_relative = Relative(VecNorm(s), state.b_norm);
+    if (s_relative <= options.tolerance) {
+      r = s;
+      history.push_back(s_relative);
+      break;
+    }
+    Precondition(options, s, z);
+    a.Apply(z.data(), t.data());
+    double t_t = VecDot(t, t);
+    omega = t_t > 0 ? VecDot(t, s) / t_t : 0;
+    VecAxpy(omega, z, state.x);
+    for (int i = 0; i < n; i++) r[i] = s[i] - omega * t[i];
+    history.push_back(Relative(VecNorm(r), state.b_norm));
+    if (omega == 0) break;
+  }
+  return Finish(state, x, iteration, history, options.tolerance);
+}
+
+S21SolverStats SolveGMRES(const S21LinearOperator &a, const S21Matrix &b,
+                          S21Matrix &x, const S21SolverOptions &options) {
+  SolverState state = Prepare(a, b, x, options);
+  int n = a.GetSize();
+  int m = std::min(options.restart, n);
+  std::vector<double> history = {Relative(VecNorm(state.r), state.b_norm)};
+  // Базис Крылова, верхняя матрица Хессенберга по столбцам и вращения Гивенса
+  std::vector<std::vector<double>> basis(m + 1, std::vector<double>(n));
+  std::vector<std::vector<double>> h(m, std::vector<double>(m + 1));
+  std::vector<double> cs(m), sn(m), g(m + 1), w(n), z(n);
+  int iteration = 0;
+  while (history.back() > options.tolerance &&
+         iteration < options.max_iterations) {
+    double beta = VecNorm(state.r);
+    for (int i = 0; i < n; i++) basis[0][i] = state.r[i] / beta;
+    std::fill(g.begin(), g.end(), 0);
+    g[0] = beta;
+    int steps = 0;
+    while (steps < m && iteration < options.max_iterations) {
+      int j = steps;
+      Precondition(options, basis[j], z);
+      a.Apply(z.data(), w.data());
+      for (int i = 0; i <= j; i++) {
+        h[j][i] = VecDot(w, basis[i]);
+        VecAxpy(-h[j][i], basis[i], w);
+      }
+      h[j][j + 1] = VecNorm(w);
+      if (h[j][j + 1] > 0) {
+        for (int i = 0; i < n; i++) basis[j + 1][i] = w[i] / h[j][j + 1];
+      }
+      for (int i = 0; i < j; i++) {
+        double top = cs[i] * h[j][i] + sn[i] * h[j][i + 1];
+        h[j][i + 1] = -sn[i] * h[j][i] + cs[i] * h[j][i + 1];
+        h[j][i] = top;
+      }
+      double radius = hypot(h[j][j], h[j][j + 1]);
+      cs[j] = radius > 0 ? h[j][j] / radius : 1;
+      sn[j] = radius > 0 ? h[j][j + 1] / radius : 0;
+      h[j][j] = radius;
+      h[j][j + 1] = 0;
+      g[j + 1] = -sn[j] * g[j];
+      g[j] = cs[j] * g[j];
+      steps++;
+      iteration++;
+      history.push_back(Relative(fabs(g[j + 1]), state.b_norm));
+      if (history.back() <= options.tolerance || radius == 0) break;
+    }
+    // Обратный ход по треугольной части H и x += M^-1 * V * y
+    std::vector<double> y(steps);
+    for (int i = steps - 1; i >= 0; i--) {
+      double sum = g[i];
+      for (int k = i + 1; k < steps; k++) sum -= h[k][i] * y[k];
+      y[i] = h[i][i] != 0 ? sum / h[i][i] : 0;
+    }
+    std::fill(w.begin(), w.end(), 0);
+    for (int i = 0; i < steps; i++) VecAxpy(y[i], basis[i], w);
+    Precondition(options, w, z);
+    VecAxpy(1, z, state.x);
+    a.Apply(state.x.data(), state.r.data());
+    for (int i = 0; i < n; i++) state.r[i] = state.b[i] - state.r[i];
+    // Оценка из вращений может расходиться с настоящей невязкой
+    history.back() = Relative(VecNorm(state.r), state.b_norm);
+    if (steps == 0) break;
+  }
+  return Finish(state, x, iteration, history, options.tolerance);
+}
+
+S21SolverStats SolveCG(const S21Matrix &a, const S21Matrix &b, S21Matrix &x,
+                       const S21SolverOptions &options) {
+  return SolveCG(S21MatrixOperator(a), b, x, options);
+}
+
+S21SolverStats SolveBiCGSTAB(const S21Matrix &a, const S21Matrix &b,
+                             S21Matrix &x, const S21SolverOptions &options) {
+  return SolveBiCGSTAB(S21MatrixOperator(a), b, x, options);
+}
+
+S21SolverStats SolveGMRES(const S21Matrix &a, const S21Matrix &b, S21Matrix &x,
+                          const S21SolverOptions &options) {
+  return SolveGMRES(S21MatrixOperator(a), b, x, options);
+}
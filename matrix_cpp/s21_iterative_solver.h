@@ -0,0 +1,116 @@
+#ifndef S21_ITERATIVE_SOLVER_H
+#define S21_ITERATIVE_SOLVER_H
+
+#include <functional>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Линейный оператор размера n x n, заданный только умножением на вектор
+class S21LinearOperator {
+ public:
+  virtual ~S21LinearOperator() = default;
+  virtual int GetSize() const = 0;
+  // y = A * x, x и y — массивы по GetSize() элементов
+  virtual void Apply(const double *x, double *y) const = 0;
+};
+
+// Плотная S21Matrix как оператор; строки умножаются параллельно. Матрица
+// должна жить, пока жив оператор
+class S21MatrixOperator : public S21LinearOperator {
+ public:
+  explicit S21MatrixOperator(const S21Matrix &matrix);
+  int GetSize() const override;
+  void Apply(const double *x, double *y) const override;
+
+ private:
+  const S21Matrix &matrix_;
+};
+
+// Оператор, заданный функцией apply(x, y)
+class S21FunctionOperator : public S21LinearOperator {
+ public:
+  S21FunctionOperator(int size,
+                      std::function<void(const double *, double *)> apply);
+  int GetSize() const override;
+  void Apply(const double *x, double *y) const override;
+
+ private:
+  int size_;
+  std::function<void(const double *, double *)> apply_;
+};
+
+// Предобуславливатель: z = M^-1 * r
+class S21Preconditioner {
+ public:
+  virtual ~S21Preconditioner() = default;
+  virtual void Apply(const double *r, double *z) const = 0;
+};
+
+// Деление на диагональ матрицы
+class S21JacobiPreconditioner : public S21Preconditioner {
+ public:
+  explicit S21JacobiPreconditioner(const S21Matrix &matrix);
+  void Apply(const double *r, double *z) const override;
+
+ private:
+  std::vector<double> inverse_diagonal_;
+};
+
+// Неполное LU-разложение без заполнения: L и U имеют те же ненулевые
+// позиции, что и исходная матрица
+class S21ILU0Preconditioner : public S21Preconditioner {
+ public:
+  explicit S21ILU0Preconditioner(const S21Matrix &matrix);
+  void Apply(const double *r, double *z) const override;
+
+ private:
+  int size_;
+  // Построчное сжатое хранение: столбцы строки i лежат в
+  // columns_[row_start_[i]..row_start_[i + 1])
+  std::vector<int> row_start_;
+  std::vector<int> columns_;
+  std::vector<double> values_;
+  std::vector<int> diagonal_;
+};
+
+struct S21SolverOptions {
+  // Остановка, когда ||b - A * x|| <= tolerance * ||b||
+  double tolerance = 1e-8;
+  int max_iterations = 1000;
+  // Длина цикла GMRES до перезапуска
+  int restart = 30;
+  // nullptr — без предобуславливания
+  const S21Preconditioner *preconditioner = nullptr;
+};
+
+struct S21SolverStats {
+  bool converged;
+  int iterations;
+  // ||b - A * x|| / ||b|| после последней итерации
+  double relative_residual;
+  // Относительная невязка после каждой итерации, первым идет начальная
+  std::vector<double> history;
+};
+
+// Решают A * x = b для столбца b. Если x уже n x 1, он используется как
+// начальное приближение, иначе поиск начинается с нуля
+S21SolverStats SolveCG(const S21LinearOperator &a, const S21Matrix &b,
+                       S21Matrix &x,
+                       const S21SolverOptions &options = S21SolverOptions());
+S21SolverStats SolveBiCGSTAB(
+    const S21LinearOperator &a, const S21Matrix &b, S21Matrix &x,
+    const S21SolverOptions &options = S21SolverOptions());
+S21SolverStats SolveGMRES(const S21LinearOperator &a, const S21Matrix &b,
+                          S21Matrix &x,
+                          const S21SolverOptions &options = S21SolverOptions());
+
+S21SolverStats SolveCG(const S21Matrix &a, const S21Matrix &b, S21Matrix &x,
+                       const S21SolverOptions &options = S21SolverOptions());
+S21SolverStats SolveBiCGSTAB(
+    const S21Matrix &a, const S21Matrix &b, S21Matrix &x,
+    const S21SolverOptions &options = S21SolverOptions());
+S21SolverStats SolveGMRES(const S21Matrix &a, const S21Matrix &b, S21Matrix &x,
+                          const S21SolverOptions &options = S21SolverOptions());
+
+#endif
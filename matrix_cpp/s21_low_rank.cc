@@ -0,0 +1,232 @@
+#include "s21_low_rank.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+namespace {
+
+constexpr int kMaxSweeps = 60;
+
+double RowDot(const double *x, const double *y, int size) {
+  double result = 0;
+  for (int i = 0; i < size; i++) result += x[i] * y[i];
+  return result;
+}
+
+// Ортонормирует строки a модифицированным методом Грама-Шмидта с повторной
+// ортогонализацией. Линейно зависимые строки обнуляются
+void OrthonormalizeRows(S21Matrix &a) {
+  int cols = a.GetCols();
+  for (int i = 0; i < a.GetRows(); i++) {
+    double *row = a.GetRowData(i);
+    double original = sqrt(RowDot(row, row, cols));
+    for (int pass = 0; pass < 2; pass++) {
+      for (int k = 0; k < i; k++) {
+        const double *basis = a.GetRowData(k);
+        double projection = RowDot(row, basis, cols);
+        for (int j = 0; j < cols; j++) row[j] -= projection * basis[j];
+      }
+    }
+    double norm = sqrt(RowDot(row, row, cols));
+    double scale = norm > 1e-12 * original ? 1 / norm : 0;
+    for (int j = 0; j < cols; j++) row[j] *= scale;
+  }
+}
+
+// Поворот Якоби строк p и q
+void RotateRows(S21Matrix &a, int p, int q, double c, double s) {
+  double *row_p = a.GetRowData(p);
+  double *row_q = a.GetRowData(q);
+  for (int j = 0; j < a.GetCols(); j++) {
+    double x = row_p[j];
+    double y = row_q[j];
+    row_p[j] = c * x - s * y;
+    row_q[j] = s * x + c * y;
+  }
+}
+
+// Односторонний метод Якоби: одинаковые повороты строк b и q, пока строки b
+// не станут попарно ортогональными. Тогда строки b равны sigma_i * v_i^T, а
+// строки q — левым сингулярным векторам
+void OrthogonalizeRows(S21Matrix &b, S21Matrix &q) {
+  int rows = b.GetRows();
+  int cols = b.GetCols();
+  for (int sweep = 0; sweep < kMaxSweeps; sweep++) {
+    bool rotated = false;
+    for (int p = 0; p < rows; p++) {
+      for (int r = p + 1; r < rows; r++) {
+        const double *row_p = b.GetRowData(p);
+        const double *row_r = b.GetRowData(r);
+        double alpha = RowDot(row_p, row_p, cols);
+        double beta = RowDot(row_r, row_r, cols);
+        double gamma = RowDot(row_p, row_r, cols);
+        if (fabs(gamma) <= 1e-15 * sqrt(alpha * beta)) continue;
+        double zeta = (beta - alpha) / (2 * gamma);
+        double t = (zeta >= 0 ? 1 : -1) / (fabs(zeta) + hypot(1, zeta));
+        double c = 1 / hypot(1, t);
+        double s = c * t;
+        RotateRows(b, p, r, c, s);
+        RotateRows(q, p, r, c, s);
+        rotated = true;
+      }
+    }
+    if (!rotated) break;
+  }
+}
+
+void CheckOptions(const S21Matrix &a, const S21LowRankOptions &options) {
+  if (options.rank < 1 ||
+      options.rank > std::min(a.GetRows(), a.GetCols()) ||
+      options.oversampling < 0 || options.power_iterations < 0) {
+    throw S21ArgumentError("Invalid low-rank options");
+  }
+}
+
+// Q^T размера l x rows: строки образуют базис образа a
+S21Matrix RangeBasis(const S21Matrix &a, const S21LowRankOptions &options) {
+  CheckOptions(a, options);
+  int samples = std::min(options.rank + options.oversampling,
+                         std::min(a.GetRows(), a.GetCols()));
+  std::mt19937_64 engine(options.seed);
+  std::normal_distribution<double> normal;
+  S21Matrix omega(samples, a.GetCols());
+  for (int i = 0; i < samples; i++) {
+    double *row = omega.GetRowData(i);
+    for (int j = 0; j < a.GetCols(); j++) row[j] = normal(engine);
+  }
+  S21Matrix qt;
+  Multiply(qt, omega, a, 1, 0, false, true);
+  OrthonormalizeRows(qt);
+  S21Matrix zt;
+  for (int i = 0; i < options.power_iterations; i++) {
+    Multiply(zt, qt, a);
+    OrthonormalizeRows(zt);
+    Multiply(qt, zt, a, 1, 0, false, true);
+    OrthonormalizeRows(qt);
+  }
+  return qt;
+}
+
+}  // namespace
+
+S21LowRankMatrix::S21LowRankMatrix(const S21Matrix &u,
+                                   const std::vector<double> &values,
+                                   const S21Matrix &vt)
+    : u_(u), values_(values), vt_(vt) {
+  int rank = static_cast<int>(values.size());
+  if (rank < 1 || u.GetCols() != rank || vt.GetRows() != rank) {
+    throw S21SizeError("Incorrect matrix size");
+  }
+}
+
+int S21LowRankMatrix::GetRows() const { return u_.GetRows(); }
+
+int S21LowRankMatrix::GetCols() const { return vt_.GetCols(); }
+
+int S21LowRankMatrix::GetRank() const {
+  return static_cast<int>(values_.size());
+}
+
+const S21Matrix &S21LowRankMatrix::GetU() const { return u_; }
+
+const std::vector<double> &S21LowRankMatrix::GetSingularValues() const {
+  return values_;
+}
+
+const S21Matrix &S21LowRankMatrix::GetVt() const { return vt_; }
+
+void S21LowRankMatrix::Truncate(int rank) {
+  if (rank < 1 || rank > GetRank()) throw S21ArgumentError("Invalid rank");
+  u_.Resize(u_.GetRows(), rank);
+  vt_.Resize(rank, vt_.GetCols());
+  values_.resize(rank);
+}
+
+S21LowRankMatrix S21LowRankMatrix::Transpose() const {
+  return S21LowRankMatrix(vt_.Transpose(), values_, u_.Transpose());
+}
+
+S21Matrix S21LowRankMatrix::ToDense() const {
+  S21Matrix scaled(u_);
+  for (int i = 0; i < scaled.GetRows(); i++) {
+    double *row = scaled.GetRowData(i);
+    for (int k = 0; k < GetRank(); k++) row[k] *= values_[k];
+  }
+  S21Matrix result;
+  Multiply(result, scaled, vt_);
+  return result;
+}
+
+S21Matrix RandomizedRangeFinder(const S21Matrix &a,
+                                const S21LowRankOptions &options) {
+  return RangeBasis(a, options).Transpose();
+}
+
+S21LowRankMatrix RandomizedSVD(const S21Matrix &a,
+                               const S21LowRankOptions &options) {
+  S21Matrix qt = RangeBasis(a, options);
+  // a ≈ q * b, SVD маленькой b переносится на a через q
+  S21Matrix b;
+  Multiply(b, qt, a);
+  OrthogonalizeRows(b, qt);
+  int samples = b.GetRows();
+  std::vector<double> norms(samples);
+  for (int i = 0; i < samples; i++) {
+    norms[i] = sqrt(RowDot(b.GetRowData(i), b.GetRowData(i), b.GetCols()));
+  }
+  std::vector<int> order(samples);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&](int x, int y) { return norms[x] > norms[y]; });
+  int rank = options.rank;
+  S21Matrix u(a.GetRows(), rank);
+  S21Matrix vt(rank, a.GetCols());
+  std::vector<double> values(rank);
+  for (int k = 0; k < rank; k++) {
+    int source = order[k];
+    values[k] = norms[source];
+    const double *left = qt.GetRowData(source);
+    for (int i = 0; i < a.GetRows(); i++) u.GetRowData(i)[k] = left[i];
+    const double *right = b.GetRowData(source);
+    double scale = values[k] > 0 ? 1 / values[k] : 0;
+    double *row = vt.GetRowData(k);
+    for (int j = 0; j < a.GetCols(); j++) row[j] = right[j] * scale;
+  }
+  return S21LowRankMatrix(u, values, vt);
+}
+
+void Multiply(S21Matrix &out, const S21LowRankMatrix &a, const S21Matrix &b) {
+  if (b.GetRows() != a.GetCols()) throw S21SizeError("Wrong matrix size");
+  S21Matrix projected;
+  Multiply(projected, a.vt_, b);
+  for (int k = 0; k < a.GetRank(); k++) {
+    double *row = projected.GetRowData(k);
+    for (int j = 0; j < projected.GetCols(); j++) row[j] *= a.values_[k];
+  }
+  Multiply(out, a.u_, projected);
+}
+
+void Multiply(S21Matrix &out, const S21Matrix &a, const S21LowRankMatrix &b) {
+  if (a.GetCols() != b.GetRows()) throw S21SizeError("Wrong matrix size");
+  S21Matrix projected;
+  Multiply(projected, a, b.u_);
+  for (int i = 0; i < projected.GetRows(); i++) {
+    double *row = projected.GetRowData(i);
+    for (int k = 0; k < b.GetRank(); k++) row[k] *= b.values_[k];
+  }
+  Multiply(out, projected, b.vt_);
+}
+
+S21Matrix operator*(const S21LowRankMatrix &a, const S21Matrix &b) {
+  S21Matrix result;
+  Multiply(result, a, b);
+  return result;
+}
+
+S21Matrix operator*(const S21Matrix &a, const S21LowRankMatrix &b) {
+  S21Matrix result;
+  Multiply(result, a, b);
+  return result;
+}
@@ -0,0 +1,63 @@
+#ifndef S21_LOW_RANK_H
+#define S21_LOW_RANK_H
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+struct S21LowRankOptions {
+  // Число сохраняемых сингулярных чисел
+  int rank = 10;
+  // Дополнительные случайные векторы сверх rank, повышают точность
+  int oversampling = 10;
+  // Умножения на a * a^T, нужны при медленно убывающем спектре
+  int power_iterations = 2;
+  unsigned long long seed = 0;
+};
+
+// Усеченное SVD: u * diag(singular_values) * vt. u — rows x rank, vt —
+// rank x cols, столбцы u и строки vt ортонормированы, сингулярные числа
+// упорядочены по убыванию. Хранит (rows + cols + 1) * rank чисел
+class S21LowRankMatrix {
+ public:
+  S21LowRankMatrix(const S21Matrix &u, const std::vector<double> &values,
+                   const S21Matrix &vt);
+
+  int GetRows() const;
+  int GetCols() const;
+  int GetRank() const;
+  const S21Matrix &GetU() const;
+  const std::vector<double> &GetSingularValues() const;
+  const S21Matrix &GetVt() const;
+
+  // Оставляет rank старших сингулярных чисел
+  void Truncate(int rank);
+  S21LowRankMatrix Transpose() const;
+  S21Matrix ToDense() const;
+
+  friend void Multiply(S21Matrix &out, const S21LowRankMatrix &a,
+                       const S21Matrix &b);
+  friend void Multiply(S21Matrix &out, const S21Matrix &a,
+                       const S21LowRankMatrix &b);
+
+ private:
+  S21Matrix u_;
+  std::vector<double> values_;
+  S21Matrix vt_;
+};
+
+// Ортонормированный базис rows x (rank + oversampling), приближающий
+// образ a: a ≈ q * q^T * a
+S21Matrix RandomizedRangeFinder(const S21Matrix &a,
+                                const S21LowRankOptions &options);
+// Рандомизированное усеченное SVD ранга options.rank
+S21LowRankMatrix RandomizedSVD(const S21Matrix &a,
+                               const S21LowRankOptions &options);
+
+void Multiply(S21Matrix &out, const S21LowRankMatrix &a, const S21Matrix &b);
+void Multiply(S21Matrix &out, const S21Matrix &a, const S21LowRankMatrix &b);
+
+S21Matrix operator*(const S21LowRankMatrix &a, const S21Matrix &b);
+S21Matrix operator*(const S21Matrix &a, const S21LowRankMatrix &b);
+
+#endif
@@ -0,0 +1,40 @@
+#include "s21_matrix_async.h"
+
+S21Task<S21Matrix> MultiplyAsync(const S21Task<S21Matrix> &a,
+                                 const S21Task<S21Matrix> &b) {
+  return S21Combine(a, b, [](const S21Matrix &x, const S21Matrix &y) {
+    S21Matrix result;
+    Multiply(result, x, y);
+    return result;
+  });
+}
+
+S21Task<S21Matrix> SumAsync(const S21Task<S21Matrix> &a,
+                            const S21Task<S21Matrix> &b) {
+  return S21Combine(a, b, [](const S21Matrix &x, const S21Matrix &y) {
+    S21Matrix result;
+    Add(result, x, y);
+    return result;
+  });
+}
+
+S21Task<S21Matrix> SubAsync(const S21Task<S21Matrix> &a,
+                            const S21Task<S21Matrix> &b) {
+  return S21Combine(a, b, [](const S21Matrix &x, const S21Matrix &y) {
+    S21Matrix result;
+    Sub(result, x, y);
+    return result;
+  });
+}
+
+S21Task<S21Matrix> TransposeAsync(const S21Task<S21Matrix> &a) {
+  return a.Then([](const S21Matrix &x) { return x.Transpose(); });
+}
+
+S21Task<S21Matrix> InverseAsync(const S21Task<S21Matrix> &a) {
+  return a.Then([](const S21Matrix &x) { return x.InverseMatrix(); });
+}
+
+S21Task<double> DeterminantAsync(const S21Task<S21Matrix> &a) {
+  return a.Then([](const S21Matrix &x) { return x.Determinant(); });
+}
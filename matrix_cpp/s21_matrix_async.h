@@ -0,0 +1,224 @@
+#ifndef S21_MATRIX_ASYNC_H
+#define S21_MATRIX_ASYNC_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#endif
+
+#include "s21_matrix_oop.h"
+#include "s21_thread_pool.h"
+
+template <class T>
+class S21Promise;
+
+// Результат операции, выполняемой в пуле потоков библиотеки. Копии задачи
+// ссылаются на одно и то же состояние. Then и S21Combine ставят следующую
+// операцию без ожидания, Get ждет результат. В C++20 задачу можно ждать через
+// co_await и возвращать из сопрограммы
+template <class T>
+class S21Task {
+  static_assert(!std::is_void<T>::value, "S21Task needs a result type");
+
+ public:
+  // Уже готовая задача
+  S21Task(T value) : state_(std::make_shared<State>()) {
+    state_->value.emplace(std::move(value));
+    state_->done = true;
+  }
+
+  bool IsReady() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->done;
+  }
+  void Wait() const {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->ready.wait(lock, [this] { return state_->done; });
+  }
+  // Ждет результат; исключение операции пробрасывается отсюда
+  const T &Get() const {
+    Wait();
+    if (state_->error) {
+      std::rethrow_exception(state_->error);
+    }
+    return *state_->value;
+  }
+  // Запускает f(результат) в пуле, когда эта задача завершится
+  template <class F>
+  auto Then(F f) const
+      -> S21Task<std::decay_t<std::invoke_result_t<F, const T &>>> {
+    using Result = std::decay_t<std::invoke_result_t<F, const T &>>;
+    S21Promise<Result> promise;
+    S21Task<Result> next = promise.GetTask();
+    std::shared_ptr<State> state = state_;
+    OnReady([state, promise, f]() mutable {
+      S21ThreadPool::Instance().Submit([state, promise, f]() mutable {
+        if (state->error) {
+          promise.SetError(state->error);
+        } else {
+          promise.Run([&] { return f(*state->value); });
+        }
+      });
+    });
+    return next;
+  }
+  // std::future с копией результата
+  std::future<T> ToFuture() const {
+    auto promise = std::make_shared<std::promise<T>>();
+    std::future<T> future = promise->get_future();
+    std::shared_ptr<State> state = state_;
+    OnReady([state, promise] {
+      if (state->error) {
+        promise->set_exception(state->error);
+      } else {
+        promise->set_value(*state->value);
+      }
+    });
+    return future;
+  }
+  // Вызывает callback сразу, если задача готова, иначе после завершения в
+  // завершающем потоке
+  void OnReady(std::function<void()> callback) const {
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      if (!state_->done) {
+        state_->callbacks.push_back(std::move(callback));
+        return;
+      }
+    }
+    callback();
+  }
+
+#if defined(__cpp_impl_coroutine)
+  bool await_ready() const { return IsReady(); }
+  void await_suspend(std::coroutine_handle<> handle) const {
+    OnReady([handle] {
+      S21ThreadPool::Instance().Submit([handle] { handle.resume(); });
+    });
+  }
+  T await_resume() const { return Get(); }
+
+  struct promise_type {
+    S21Promise<T> promise;
+    S21Task get_return_object() { return promise.GetTask(); }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_value(T value) { promise.SetValue(std::move(value)); }
+    void unhandled_exception() { promise.SetError(std::current_exception()); }
+  };
+#endif
+
+ private:
+  friend class S21Promise<T>;
+
+  struct State {
+    std::mutex mutex;
+    std::condition_variable ready;
+    bool done = false;
+    std::optional<T> value;
+    std::exception_ptr error;
+    std::vector<std::function<void()>> callbacks;
+  };
+  std::shared_ptr<State> state_;
+
+  explicit S21Task(std::shared_ptr<State> state) : state_(std::move(state)) {}
+};
+
+// Сторона, которая завершает задачу
+template <class T>
+class S21Promise {
+ public:
+  S21Promise() : state_(std::make_shared<State>()) {}
+
+  S21Task<T> GetTask() const { return S21Task<T>(state_); }
+  void SetValue(T value) { Finish(std::move(value), nullptr); }
+  void SetError(std::exception_ptr error) { Finish(std::nullopt, error); }
+  // Завершает задачу результатом fn() или брошенным ею исключением
+  template <class F>
+  void Run(F fn) {
+    try {
+      SetValue(fn());
+    } catch (...) {
+      SetError(std::current_exception());
+    }
+  }
+
+ private:
+  using State = typename S21Task<T>::State;
+  std::shared_ptr<State> state_;
+
+  void Finish(std::optional<T> value, std::exception_ptr error) {
+    std::vector<std::function<void()>> callbacks;
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      if (state_->done) {
+        S21_THROW(S21StateError("Task already finished"));
+      }
+      state_->value = std::move(value);
+      state_->error = error;
+      state_->done = true;
+      callbacks.swap(state_->callbacks);
+    }
+    state_->ready.notify_all();
+    for (std::function<void()> &callback : callbacks) {
+      callback();
+    }
+  }
+};
+
+// Выполняет f() в пуле потоков
+template <class F>
+auto S21Async(F f) -> S21Task<std::decay_t<std::invoke_result_t<F>>> {
+  S21Promise<std::decay_t<std::invoke_result_t<F>>> promise;
+  auto task = promise.GetTask();
+  S21ThreadPool::Instance().Submit(
+      [promise, f]() mutable { promise.Run(f); });
+  return task;
+}
+
+// Выполняет f(a, b), когда готовы обе задачи, не занимая поток ожиданием
+template <class A, class B, class F>
+auto S21Combine(const S21Task<A> &a, const S21Task<B> &b, F f)
+    -> S21Task<std::decay_t<std::invoke_result_t<F, const A &, const B &>>> {
+  using Result = std::decay_t<std::invoke_result_t<F, const A &, const B &>>;
+  S21Promise<Result> promise;
+  S21Task<Result> next = promise.GetTask();
+  auto remaining = std::make_shared<std::atomic<int>>(2);
+  auto start = [a, b, promise, f, remaining]() mutable {
+    if (--*remaining != 0) {
+      return;
+    }
+    S21ThreadPool::Instance().Submit([a, b, promise, f]() mutable {
+      promise.Run([&] { return f(a.Get(), b.Get()); });
+    });
+  };
+  a.OnReady(start);
+  b.OnReady(start);
+  return next;
+}
+
+// Асинхронные варианты операций S21Matrix. Операнды — задачи, поэтому
+// зависимые операции выстраиваются в цепочку без блокировок; готовую матрицу
+// можно передать вместо задачи
+S21Task<S21Matrix> MultiplyAsync(const S21Task<S21Matrix> &a,
+                                 const S21Task<S21Matrix> &b);
+S21Task<S21Matrix> SumAsync(const S21Task<S21Matrix> &a,
+                            const S21Task<S21Matrix> &b);
+S21Task<S21Matrix> SubAsync(const S21Task<S21Matrix> &a,
+                            const S21Task<S21Matrix> &b);
+S21Task<S21Matrix> TransposeAsync(const S21Task<S21Matrix> &a);
+S21Task<S21Matrix> InverseAsync(const S21Task<S21Matrix> &a);
+S21Task<double> DeterminantAsync(const S21Task<S21Matrix> &a);
+
+#endif
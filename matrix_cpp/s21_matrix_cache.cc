@@ -0,0 +1,60 @@
+#include "s21_matrix_cache.h"
+
+#include <atomic>
+
+namespace {
+
+std::atomic<size_t> cache_limit(64 << 20);
+
+}  // namespace
+
+S21MatrixCache::S21MatrixCache() {
+  for (Entry &entry : entries_) {
+    entry.filled = false;
+    entry.version = 0;
+    entry.last_use = 0;
+    entry.bytes = 0;
+  }
+  tick_ = 0;
+  bytes_ = 0;
+}
+
+void S21MatrixCache::SetLimit(size_t bytes) { cache_limit = bytes; }
+
+size_t S21MatrixCache::GetLimit() { return cache_limit; }
+
+void S21MatrixCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (Entry &entry : entries_) Drop(entry);
+}
+
+size_t S21MatrixCache::GetBytes() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bytes_;
+}
+
+bool S21MatrixCache::MakeRoom(size_t bytes) {
+  size_t limit = cache_limit;
+  if (bytes > limit) {
+    return false;
+  }
+  while (bytes_ + bytes > limit) {
+    Entry *oldest = nullptr;
+    for (Entry &entry : entries_) {
+      if (entry.filled && (oldest == nullptr ||
+                           entry.last_use < oldest->last_use)) {
+        oldest = &entry;
+      }
+    }
+    Drop(*oldest);
+  }
+  return true;
+}
+
+void S21MatrixCache::Drop(Entry &entry) {
+  if (entry.filled) {
+    bytes_ -= entry.bytes;
+    entry.value.reset();
+    entry.filled = false;
+  }
+}
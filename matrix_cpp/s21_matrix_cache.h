@@ -0,0 +1,116 @@
+#ifndef S21_MATRIX_CACHE_H
+#define S21_MATRIX_CACHE_H
+
+#include <any>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "s21_matrix_oop.h"
+
+// Кэш величин, вычисленных по матрице. Каждая запись помнит версию матрицы, по
+// которой она посчитана, и перестает находиться, как только матрица изменится.
+// Объем кэша одной матрицы ограничен, при переполнении вытесняются записи,
+// которые дольше всего не запрашивались
+class S21MatrixCache {
+ public:
+  enum Kind {
+    kInverse,
+    kLU,
+    kCholesky,
+    kFrobeniusNorm,
+    kNorm1,
+    kNormInf,
+    kKindCount
+  };
+
+  S21MatrixCache();
+
+  // Предел объема кэша одной матрицы в байтах, 0 отключает кэширование
+  static void SetLimit(size_t bytes);
+  static size_t GetLimit();
+
+  // Возвращает запись, посчитанную для версии version, или nullptr
+  template <class T>
+  std::shared_ptr<const T> Find(Kind kind, unsigned long long version);
+  // Запоминает value, если оно помещается в предел, и возвращает указатель
+  // на него в любом случае
+  template <class T>
+  std::shared_ptr<const T> Store(Kind kind, unsigned long long version,
+                                 T value, size_t bytes);
+  void Clear();
+  size_t GetBytes();
+
+ private:
+  struct Entry {
+    bool filled;
+    unsigned long long version;
+    unsigned long long last_use;
+    size_t bytes;
+    std::any value;
+  };
+
+  std::mutex mutex_;
+  Entry entries_[kKindCount];
+  unsigned long long tick_;
+  size_t bytes_;
+
+  // Освобождает место под bytes байт; false, если запись не поместится вовсе
+  bool MakeRoom(size_t bytes);
+  void Drop(Entry &entry);
+};
+
+// Возвращает значение из кэша матрицы a или считает его через compute() и
+// запоминает. bytes — сколько памяти займет результат. Значение отдается
+// указателем на запись кэша, поэтому попадание в кэш ничего не копирует
+template <class T, class Compute>
+std::shared_ptr<const T> S21Memoize(const S21Matrix &a,
+                                    S21MatrixCache::Kind kind, size_t bytes,
+                                    Compute compute) {
+  S21MatrixCache &cache = a.GetCache();
+  unsigned long long version = a.GetVersion();
+  if (std::shared_ptr<const T> found = cache.Find<T>(kind, version)) {
+    return found;
+  }
+  return cache.Store<T>(kind, version, compute(), bytes);
+}
+
+template <class T>
+std::shared_ptr<const T> S21MatrixCache::Find(Kind kind,
+                                              unsigned long long version) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Entry &entry = entries_[kind];
+  if (!entry.filled) {
+    return nullptr;
+  }
+  if (entry.version != version) {
+    // Матрица изменилась — все записи устарели
+    for (Entry &other : entries_) Drop(other);
+    return nullptr;
+  }
+  entry.last_use = ++tick_;
+  return std::any_cast<std::shared_ptr<const T>>(entry.value);
+}
+
+template <class T>
+std::shared_ptr<const T> S21MatrixCache::Store(Kind kind,
+                                               unsigned long long version,
+                                               T value, size_t bytes) {
+  std::shared_ptr<const T> stored(new T(std::move(value)));
+  std::lock_guard<std::mutex> lock(mutex_);
+  Drop(entries_[kind]);
+  if (!MakeRoom(bytes)) {
+    return stored;
+  }
+  Entry &entry = entries_[kind];
+  entry.filled = true;
+  entry.version = version;
+  entry.last_use = ++tick_;
+  entry.bytes = bytes;
+  entry.value = stored;
+  bytes_ += bytes;
+  return stored;
+}
+
+#endif
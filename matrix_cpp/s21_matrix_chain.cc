@@ -0,0 +1,143 @@
+#include "s21_matrix_chain.h"
+
+S21MatrixChain::S21MatrixChain() { planned_ = false; }
+
+S21MatrixChain::S21MatrixChain(const S21Matrix &first, bool transposed) {
+  planned_ = false;
+  Append(first, transposed);
+}
+
+S21MatrixChain &S21MatrixChain::Append(const S21Matrix &other,
+                                       bool transposed) {
+  int rows = transposed ? other.cols_ : other.rows_;
+  int cols = transposed ? other.rows_ : other.cols_;
+  if (dims_.empty()) {
+    dims_.push_back(rows);
+  } else if (dims_.back() != rows) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  dims_.push_back(cols);
+  operands_.push_back(Operand(&other, transposed));
+  planned_ = false;
+  return *this;
+}
+
+S21Matrix S21MatrixChain::Evaluate() {
+  S21Matrix result;
+  Evaluate(result);
+  return result;
+}
+
+void S21MatrixChain::Evaluate(S21Matrix &out) {
+  if (operands_.empty()) {
+    throw S21SizeError("Empty chain");
+  }
+  Optimize();
+  int n = GetSize();
+  if (n == 1) {
+    const S21Matrix *m = operands_[0].first;
+    if (operands_[0].second) {
+      S21Matrix copy;
+      if (&out == m) {
+        copy = *m;
+        m = &copy;
+      }
+      out.Reallocate(m->cols_, m->rows_);
+      for (int i = 0; i < m->rows_; i++) {
+        for (int j = 0; j < m->cols_; j++) {
+          out.matrix_[j][i] = m->matrix_[i][j];
+        }
+      }
+    } else {
+      out = *m;
+    }
+    return;
+  }
+  // Одинаковые подцепочки вычисляются один раз
+  std::map<Key, S21Matrix> memo;
+  Operand left = Compute(0, split_[0][n - 1], memo);
+  Operand right = Compute(split_[0][n - 1] + 1, n - 1, memo);
+  Multiply(out, *left.first, *right.first, 1.0, 0.0, left.second,
+           right.second);
+}
+
+long long S21MatrixChain::Cost() {
+  if (operands_.empty()) {
+    return 0;
+  }
+  Optimize();
+  return cost_[0][GetSize() - 1];
+}
+
+long long S21MatrixChain::NaiveCost() {
+  long long result = 0;
+  for (int i = 1; i < GetSize(); i++) {
+    result += (long long)dims_[0] * dims_[i] * dims_[i + 1];
+  }
+  return result;
+}
+
+std::string S21MatrixChain::Plan() {
+  if (operands_.empty()) {
+    return "";
+  }
+  Optimize();
+  return PlanString(0, GetSize() - 1);
+}
+
+int S21MatrixChain::GetSize() { return (int)operands_.size(); }
+
+void S21MatrixChain::Optimize() {
+  if (planned_) {
+    return;
+  }
+  int n = GetSize();
+  cost_.assign(n, std::vector<long long>(n, 0));
+  split_.assign(n, std::vector<int>(n, 0));
+  for (int len = 2; len <= n; len++) {
+    for (int i = 0; i + len - 1 < n; i++) {
+      int j = i + len - 1;
+      cost_[i][j] = -1;
+      for (int k = i; k < j; k++) {
+        long long cost = cost_[i][k] + cost_[k + 1][j] +
+                         (long long)dims_[i] * dims_[k + 1] * dims_[j + 1];
+        if (cost_[i][j] < 0 || cost < cost_[i][j]) {
+          cost_[i][j] = cost;
+          split_[i][j] = k;
+        }
+      }
+    }
+  }
+  planned_ = true;
+}
+
+S21MatrixChain::Operand S21MatrixChain::Compute(
+    int i, int j, std::map<Key, S21Matrix> &memo) {
+  if (i == j) {
+    return operands_[i];
+  }
+  Key key(operands_.begin() + i, operands_.begin() + j + 1);
+  auto found = memo.find(key);
+  if (found == memo.end()) {
+    Operand left = Compute(i, split_[i][j], memo);
+    Operand right = Compute(split_[i][j] + 1, j, memo);
+    S21Matrix &result = memo[key];
+    Multiply(result, *left.first, *right.first, 1.0, 0.0, left.second,
+             right.second);
+    return Operand(&result, false);
+  }
+  return Operand(&found->second, false);
+}
+
+std::string S21MatrixChain::PlanString(int i, int j) {
+  if (i == j) {
+    return "A" + std::to_string(i);
+  }
+  return "(" + PlanString(i, split_[i][j]) + "*" +
+         PlanString(split_[i][j] + 1, j) + ")";
+}
+
+S21MatrixChain operator*(S21MatrixChain chain, const S21Matrix &other) {
+  chain.Append(other);
+  return chain;
+}
@@ -0,0 +1,53 @@
+#ifndef S21_MATRIX_CHAIN_H
+#define S21_MATRIX_CHAIN_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Отложенное произведение нескольких матриц. Операнды только запоминаются,
+// порядок умножения выбирается динамическим программированием при вычислении.
+// Матрицы-операнды должны жить, пока жива цепочка
+class S21MatrixChain {
+ public:
+  S21MatrixChain();
+  explicit S21MatrixChain(const S21Matrix &first, bool transposed = false);
+
+  // Добавляет справа очередной множитель (транспонированный при transposed)
+  S21MatrixChain &Append(const S21Matrix &other, bool transposed = false);
+  // Вычисляет произведение в оптимальном порядке
+  S21Matrix Evaluate();
+  // Вычисляет произведение в out, переиспользуя его память
+  void Evaluate(S21Matrix &out);
+
+  // Количество умножений-сложений при оптимальной расстановке скобок
+  long long Cost();
+  // Количество умножений-сложений при вычислении слева направо
+  long long NaiveCost();
+  // Расстановка скобок, например "(A0*(A1*A2))"
+  std::string Plan();
+  int GetSize();
+
+ private:
+  // Операнд вместе с флагом транспонирования
+  using Operand = std::pair<const S21Matrix *, bool>;
+  using Key = std::vector<Operand>;
+
+  std::vector<Operand> operands_;
+  // dims_[i] x dims_[i + 1] — размер i-го множителя
+  std::vector<int> dims_;
+  std::vector<std::vector<long long>> cost_;
+  std::vector<std::vector<int>> split_;
+  bool planned_;
+
+  void Optimize();
+  Operand Compute(int i, int j, std::map<Key, S21Matrix> &memo);
+  std::string PlanString(int i, int j);
+};
+
+S21MatrixChain operator*(S21MatrixChain chain, const S21Matrix &other);
+
+#endif
@@ -0,0 +1,134 @@
+#include "s21_matrix_decompose.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "s21_matrix_cache.h"
+#include "s21_matrix_reduce.h"
+
+namespace {
+
+S21LUFactors ComputeLU(const S21Matrix &a) {
+  int n = a.GetRows();
+  S21LUFactors result = {a, std::vector<int>(n), 1, false};
+  for (int i = 0; i < n; i++) result.permutation[i] = i;
+  // Ведущий элемент, сравнимый с ошибкой округления, — признак неполного
+  // ранга: точного нуля после вычитаний обычно не получается
+  double tolerance =
+      n * std::numeric_limits<double>::epsilon() * MaxAbs(a);
+  S21Matrix &lu = result.lu;
+  for (int k = 0; k < n; k++) {
+    int pivot = k;
+    for (int i = k + 1; i < n; i++) {
+      if (fabs(lu.GetRowData(i)[k]) > fabs(lu.GetRowData(pivot)[k])) {
+        pivot = i;
+      }
+    }
+    if (pivot != k) {
+      std::swap_ranges(lu.GetRowData(k), lu.GetRowData(k) + n,
+                       lu.GetRowData(pivot));
+      std::swap(result.permutation[k], result.permutation[pivot]);
+      result.determinant = -result.determinant;
+    }
+    const double *pivot_row = lu.GetRowData(k);
+    result.determinant *= pivot_row[k];
+    if (fabs(pivot_row[k]) <= tolerance) {
+      result.singular = true;
+    }
+    if (pivot_row[k] == 0) {
+      continue;
+    }
+    for (int i = k + 1; i < n; i++) {
+      double *row = lu.GetRowData(i);
+      double factor = row[k] / pivot_row[k];
+      row[k] = factor;
+      for (int j = k + 1; j < n; j++) row[j] -= factor * pivot_row[j];
+    }
+  }
+  if (result.singular) {
+    result.determinant = 0;
+  }
+  return result;
+}
+
+S21Matrix ComputeCholesky(const S21Matrix &a) {
+  int n = a.GetRows();
+  S21Matrix factor(n, n);
+  for (int i = 0; i < n; i++) {
+    const double *a_row = a.GetRowData(i);
+    double *row = factor.GetRowData(i);
+    for (int j = 0; j <= i; j++) {
+      const double *other = factor.GetRowData(j);
+      double value = a_row[j];
+      for (int k = 0; k < j; k++) value -= row[k] * other[k];
+      if (i == j) {
+        if (value <= 0) {
+          throw S21SingularError("Matrix not positive definite");
+        }
+        row[i] = sqrt(value);
+      } else {
+        row[j] = value / other[j];
+      }
+    }
+  }
+  return factor;
+}
+
+void CheckSquare(const S21Matrix &a) {
+  if (a.GetRows() != a.GetCols() || a.GetRows() == 0) {
+    throw S21SizeError("Matrix not square");
+  }
+}
+
+}  // namespace
+
+std::shared_ptr<const S21LUFactors> LUDecompose(const S21Matrix &a) {
+  CheckSquare(a);
+  size_t bytes = sizeof(double) * a.GetRows() * a.GetCols() +
+                 sizeof(int) * a.GetRows();
+  return S21Memoize<S21LUFactors>(a, S21MatrixCache::kLU, bytes,
+                                  [&] { return ComputeLU(a); });
+}
+
+std::shared_ptr<const S21Matrix> CholeskyDecompose(const S21Matrix &a) {
+  CheckSquare(a);
+  size_t bytes = sizeof(double) * a.GetRows() * a.GetCols();
+  return S21Memoize<S21Matrix>(a, S21MatrixCache::kCholesky, bytes,
+                               [&] { return ComputeCholesky(a); });
+}
+
+S21Matrix Solve(const S21Matrix &a, const S21Matrix &b) {
+  CheckSquare(a);
+  int n = a.GetRows();
+  if (b.GetRows() != n) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  std::shared_ptr<const S21LUFactors> shared = LUDecompose(a);
+  const S21LUFactors &factors = *shared;
+  if (factors.singular) {
+    throw S21SingularError("Null determinant");
+  }
+  int cols = b.GetCols();
+  S21Matrix x(n, cols);
+  for (int i = 0; i < n; i++) {
+    const double *lu_row = factors.lu.GetRowData(i);
+    double *row = x.GetRowData(i);
+    std::copy(b.GetRowData(factors.permutation[i]),
+              b.GetRowData(factors.permutation[i]) + cols, row);
+    for (int k = 0; k < i; k++) {
+      const double *solved = x.GetRowData(k);
+      for (int j = 0; j < cols; j++) row[j] -= lu_row[k] * solved[j];
+    }
+  }
+  for (int i = n - 1; i >= 0; i--) {
+    const double *lu_row = factors.lu.GetRowData(i);
+    double *row = x.GetRowData(i);
+    for (int k = i + 1; k < n; k++) {
+      const double *solved = x.GetRowData(k);
+      for (int j = 0; j < cols; j++) row[j] -= lu_row[k] * solved[j];
+    }
+    for (int j = 0; j < cols; j++) row[j] /= lu_row[i];
+  }
+  return x;
+}
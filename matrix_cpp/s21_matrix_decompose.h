@@ -0,0 +1,32 @@
+#ifndef S21_MATRIX_DECOMPOSE_H
+#define S21_MATRIX_DECOMPOSE_H
+
+#include <memory>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// LU-разложение с выбором главного элемента: строка i матрицы L * U равна
+// строке permutation[i] исходной матрицы. L хранится под диагональю lu с
+// единицами на диагонали, U — на диагонали и выше
+struct S21LUFactors {
+  S21Matrix lu;
+  std::vector<int> permutation;
+  // Для вырожденной матрицы — ровно 0
+  double determinant;
+  // Матрица численно вырождена: какой-то ведущий элемент не больше
+  // n * eps * max|a_ij|
+  bool singular;
+};
+
+// Разложения запоминаются в кэше матрицы и пересчитываются только после ее
+// изменения. Возвращается указатель на запись кэша, поэтому повторный запрос
+// к неизменной матрице ничего не копирует
+std::shared_ptr<const S21LUFactors> LUDecompose(const S21Matrix &a);
+// Нижнетреугольная L, для которой L * L^T = a; a должна быть симметричной
+// положительно определенной
+std::shared_ptr<const S21Matrix> CholeskyDecompose(const S21Matrix &a);
+// Решение a * x = b через закэшированное LU-разложение
+S21Matrix Solve(const S21Matrix &a, const S21Matrix &b);
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef S21_MATRIX_ERROR_H
+#define S21_MATRIX_ERROR_H
+
+#include <cstdlib>
+#include <exception>
+
+// Коды ошибок. Их возвращает API без исключений (s21_matrix_status.h), и
+// они же хранятся в исключениях основного API
+enum class S21Status {
+  kOk,
+  // Размеры операндов не подходят для операции или недопустимы
+  kSizeError,
+  kIndexError,
+  // Вырожденная матрица, нулевой ведущий элемент и подобное
+  kSingular,
+  kInvalidArgument,
+  // Операция недопустима в текущем состоянии объекта
+  kStateError,
+  // Ошибка операционной системы: память, файлы, сокеты
+  kSystemError,
+  kOutOfMemory
+};
+
+// Текстовое описание кода
+inline const char *S21StatusMessage(S21Status status) {
+  switch (status) {
+    case S21Status::kOk:
+      return "Ok";
+    case S21Status::kSizeError:
+      return "Wrong matrix size";
+    case S21Status::kIndexError:
+      return "Index out of range";
+    case S21Status::kSingular:
+      return "Singular matrix";
+    case S21Status::kInvalidArgument:
+      return "Invalid argument";
+    case S21Status::kStateError:
+      return "Invalid state";
+    case S21Status::kSystemError:
+      return "System error";
+    case S21Status::kOutOfMemory:
+      return "Out of memory";
+  }
+  return "Unknown error";
+}
+
+// Базовый класс исключений библиотеки. what() возвращает то же сообщение,
+// что раньше бросалось строкой
+class S21MatrixError : public std::exception {
+ public:
+  S21MatrixError(S21Status status, const char *message)
+      : status_(status), message_(message) {}
+  const char *what() const noexcept override { return message_; }
+  S21Status GetStatus() const noexcept { return status_; }
+
+ private:
+  S21Status status_;
+  const char *message_;
+};
+
+class S21SizeError : public S21MatrixError {
+ public:
+  explicit S21SizeError(const char *message)
+      : S21MatrixError(S21Status::kSizeError, message) {}
+};
+
+class S21IndexError : public S21MatrixError {
+ public:
+  explicit S21IndexError(const char *message)
+      : S21MatrixError(S21Status::kIndexError, message) {}
+};
+
+class S21SingularError : public S21MatrixError {
+ public:
+  explicit S21SingularError(const char *message)
+      : S21MatrixError(S21Status::kSingular, message) {}
+};
+
+class S21ArgumentError : public S21MatrixError {
+ public:
+  explicit S21ArgumentError(const char *message)
+      : S21MatrixError(S21Status::kInvalidArgument, message) {}
+};
+
+class S21StateError : public S21MatrixError {
+ public:
+  explicit S21StateError(const char *message)
+      : S21MatrixError(S21Status::kStateError, message) {}
+};
+
+class S21SystemError : public S21MatrixError {
+ public:
+  explicit S21SystemError(const char *message)
+      : S21MatrixError(S21Status::kSystemError, message) {}
+};
+
+// Для кода в заголовках: при сборке с -fno-exceptions ошибка завершает
+// программу, как assert
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+#define S21_THROW(error) throw error
+#else
+#define S21_THROW(error) std::abort()
+#endif
+
+#endif
@@ -0,0 +1,192 @@
+#include "s21_matrix_map.h"
+
+#include <cmath>
+#include <utility>
+
+#include "s21_matrix_decompose.h"
+#include "s21_matrix_reduce.h"
+
+namespace {
+
+// Коэффициенты числителя аппроксимаций Паде степеней 3, 5, 7, 9 и 13 и
+// границы нормы, до которых они дают ошибку не выше машинной точности
+// (Higham, "The scaling and squaring method for the matrix exponential
+// revisited", 2005)
+const int kPadeDegrees[] = {3, 5, 7, 9};
+const double kPadeTheta[] = {1.495585217958292e-2, 2.539398330063230e-1,
+                             9.504178996162932e-1, 2.097847961257068e0};
+const double kPade3[] = {120, 60, 12, 1};
+const double kPade5[] = {30240, 15120, 3360, 420, 30, 1};
+const double kPade7[] = {17297280, 8648640, 1995840, 277200,
+                         25200,    1512,    56,      1};
+const double kPade9[] = {17643225600, 8821612800, 2075673600, 302702400,
+                         30270240,    2162160,    110880,     3960,
+                         90,          1};
+const double *const kPadeCoefficients[] = {kPade3, kPade5, kPade7, kPade9};
+const double kPade13Theta = 5.371920351148152;
+const double kPade13[] = {64764752532480000.0,
+                          32382376266240000.0,
+                          7771770303897600.0,
+                          1187353796428800.0,
+                          129060195264000.0,
+                          10559470521600.0,
+                          670442572800.0,
+                          33522128640.0,
+                          1323241920.0,
+                          40840800.0,
+                          960960.0,
+                          16380.0,
+                          182.0,
+                          1.0};
+
+S21Matrix Identity(int n) {
+  S21Matrix result(n, n);
+  for (int i = 0; i < n; i++) result.Unchecked(i, i) = 1;
+  return result;
+}
+
+// out += c * p
+void AddScaled(S21Matrix &out, const S21Matrix &p, double c) {
+  ZipMap(out, out, p, [c](double x, double y) { return x + c * y; });
+}
+
+// Решает (v - u) x = v + u — знаменатель и числитель Паде
+S21Matrix SolvePade(const S21Matrix &u, const S21Matrix &v) {
+  S21Matrix numerator, denominator;
+  Add(numerator, v, u);
+  Sub(denominator, v, u);
+  return Solve(denominator, numerator);
+}
+
+// Аппроксимация Паде нечетной степени m <= 9: четные степени a
+// накапливаются по очереди, нечетная часть получается умножением на a
+S21Matrix PadeLow(const S21Matrix &a, const double *b, int m) {
+  int n = a.GetRows();
+  S21Matrix a2, power = Identity(n), next;
+  Multiply(a2, a, a);
+  S21Matrix odd(n, n), v(n, n);
+  for (int k = 0; 2 * k < m; k++) {
+    if (k > 0) {
+      Multiply(next, power, a2);
+      std::swap(power, next);
+    }
+    AddScaled(v, power, b[2 * k]);
+    AddScaled(odd, power, b[2 * k + 1]);
+  }
+  S21Matrix u;
+  Multiply(u, a, odd);
+  return SolvePade(u, v);
+}
+
+// Аппроксимация Паде степени 13 по схеме Хайэма: шесть умножений матриц
+S21Matrix Pade13(const S21Matrix &a) {
+  const double *b = kPade13;
+  int n = a.GetRows();
+  S21Matrix identity = Identity(n), a2, a4, a6;
+  Multiply(a2, a, a);
+  Multiply(a4, a2, a2);
+  Multiply(a6, a4, a2);
+
+  S21Matrix inner(n, n), odd;
+  AddScaled(inner, a6, b[13]);
+  AddScaled(inner, a4, b[11]);
+  AddScaled(inner, a2, b[9]);
+  Multiply(odd, a6, inner);
+  AddScaled(odd, a6, b[7]);
+  AddScaled(odd, a4, b[5]);
+  AddScaled(odd, a2, b[3]);
+  AddScaled(odd, identity, b[1]);
+  S21Matrix u;
+  Multiply(u, a, odd);
+
+  S21Matrix v;
+  inner.Fill(0);
+  AddScaled(inner, a6, b[12]);
+  AddScaled(inner, a4, b[10]);
+  AddScaled(inner, a2, b[8]);
+  Multiply(v, a6, inner);
+  AddScaled(v, a6, b[6]);
+  AddScaled(v, a4, b[4]);
+  AddScaled(v, a2, b[2]);
+  AddScaled(v, identity, b[0]);
+  return SolvePade(u, v);
+}
+
+void CheckSquare(const S21Matrix &a) {
+  if (a.GetRows() != a.GetCols()) {
+    throw S21SizeError("Wrong matrix size");
+  }
+}
+
+}  // namespace
+
+void HadamardMultiply(S21Matrix &out, const S21Matrix &a, const S21Matrix &b) {
+  ZipMap(out, a, b, [](double x, double y) { return x * y; });
+}
+
+void HadamardDivide(S21Matrix &out, const S21Matrix &a, const S21Matrix &b) {
+  ZipMap(out, a, b, [](double x, double y) { return x / y; });
+}
+
+void Power(S21Matrix &out, const S21Matrix &a, int exponent) {
+  CheckSquare(a);
+  if (a.GetRows() == 0) {
+    out = S21Matrix();
+    return;
+  }
+  long long remaining = exponent;
+  S21Matrix base = remaining < 0 ? a.InverseMatrix() : a;
+  if (remaining < 0) {
+    remaining = -remaining;
+  }
+  // Единичная матрица не строится, пока в результат не попадет первый
+  // множитель
+  S21Matrix result, next;
+  bool started = false;
+  while (remaining > 0) {
+    if (remaining & 1) {
+      if (started) {
+        Multiply(next, result, base);
+        std::swap(result, next);
+      } else {
+        result = base;
+        started = true;
+      }
+    }
+    remaining >>= 1;
+    if (remaining > 0) {
+      Multiply(next, base, base);
+      std::swap(base, next);
+    }
+  }
+  out = started ? std::move(result) : Identity(a.GetRows());
+}
+
+void Exponential(S21Matrix &out, const S21Matrix &a) {
+  CheckSquare(a);
+  if (a.GetRows() == 0) {
+    out = S21Matrix();
+    return;
+  }
+  double norm = Norm1(a);
+  if (!std::isfinite(norm)) {
+    throw S21ArgumentError("Matrix is not finite");
+  }
+  for (int i = 0; i < 4; i++) {
+    if (norm <= kPadeTheta[i]) {
+      out = PadeLow(a, kPadeCoefficients[i], kPadeDegrees[i]);
+      return;
+    }
+  }
+  // Масштабируем так, чтобы норма a / 2^s не превышала границу степени 13,
+  // и возводим результат в квадрат s раз
+  int squarings = std::max(0, (int)std::ceil(std::log2(norm / kPade13Theta)));
+  S21Matrix scaled;
+  Scale(scaled, a, std::ldexp(1.0, -squarings));
+  S21Matrix result = Pade13(scaled), next;
+  for (int i = 0; i < squarings; i++) {
+    Multiply(next, result, result);
+    std::swap(result, next);
+  }
+  out = std::move(result);
+}
@@ -0,0 +1,74 @@
+#ifndef S21_MATRIX_MAP_H
+#define S21_MATRIX_MAP_H
+
+#include <algorithm>
+
+#include "s21_matrix_oop.h"
+#include "s21_thread_pool.h"
+#include "s21_tuning.h"
+
+// Поэлементные преобразования и функции от матриц. Map и ZipMap —
+// шаблоны: функция подставляется в цикл по строке с единичным шагом, который
+// компилятор может векторизовать, а строки делятся между потоками пула.
+// out может совпадать с любым из операндов
+
+// out(i, j) = f(a(i, j))
+template <class F>
+void Map(S21Matrix &out, const S21Matrix &a, F f);
+// out(i, j) = f(a(i, j), b(i, j)); размеры a и b должны совпадать
+template <class F>
+void ZipMap(S21Matrix &out, const S21Matrix &a, const S21Matrix &b, F f);
+
+// Поэлементные произведение и частное (произведение Адамара)
+void HadamardMultiply(S21Matrix &out, const S21Matrix &a, const S21Matrix &b);
+void HadamardDivide(S21Matrix &out, const S21Matrix &a, const S21Matrix &b);
+
+// out = a^exponent возведением в квадрат; a^0 — единичная матрица, для
+// отрицательной степени возводится обратная матрица. Степень пустой
+// матрицы — пустая матрица
+void Power(S21Matrix &out, const S21Matrix &a, int exponent);
+// Матричная экспонента: масштабирование и возведение в квадрат с
+// аппроксимацией Паде (алгоритм Хайэма)
+void Exponential(S21Matrix &out, const S21Matrix &a);
+
+// Общий проход по строкам для Map и ZipMap. Адрес данных out берется до
+// запуска потоков, потому что неконстантный доступ меняет версию матрицы
+template <class Row>
+void S21MapRows(S21Matrix &out, int rows, int cols, Row row) {
+  if (out.GetRows() != rows || out.GetCols() != cols) {
+    out = rows > 0 && cols > 0 ? S21Matrix(rows, cols) : S21Matrix();
+  }
+  if (rows == 0 || cols == 0) {
+    return;
+  }
+  double *data = out.GetData();
+  int stride = out.GetStride();
+  int grain = std::max(1, S21GetTuning().parallel_elements / cols);
+  S21ThreadPool::Instance().ParallelFor(0, rows, grain, [&](int from, int to) {
+    for (int i = from; i < to; i++) row(i, data + (long long)i * stride);
+  });
+}
+
+template <class F>
+void Map(S21Matrix &out, const S21Matrix &a, F f) {
+  int cols = a.GetCols();
+  S21MapRows(out, a.GetRows(), cols, [&](int i, double *row) {
+    const double *source = a.GetRowData(i);
+    for (int j = 0; j < cols; j++) row[j] = f(source[j]);
+  });
+}
+
+template <class F>
+void ZipMap(S21Matrix &out, const S21Matrix &a, const S21Matrix &b, F f) {
+  if (a.GetRows() != b.GetRows() || a.GetCols() != b.GetCols()) {
+    S21_THROW(S21SizeError("Wrong matrix size"));
+  }
+  int cols = a.GetCols();
+  S21MapRows(out, a.GetRows(), cols, [&](int i, double *row) {
+    const double *left = a.GetRowData(i);
+    const double *right = b.GetRowData(i);
+    for (int j = 0; j < cols; j++) row[j] = f(left[j], right[j]);
+  });
+}
+
+#endif
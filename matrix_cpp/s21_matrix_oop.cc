@@ -1,59 +1,123 @@
 #include "s21_matrix_oop.h"
 
+#include <algorithm>
+#include <utility>
+
+#include "s21_allocator.h"
+#include "s21_matrix_cache.h"
+#include "s21_matrix_decompose.h"
+#include "s21_thread_pool.h"
+#include "s21_tuning.h"
+
 S21Matrix::S21Matrix() {
   rows_ = 0;
   cols_ = 0;
   matrix_ = nullptr;
+  data_ = nullptr;
+  owns_data_ = true;
+  row_capacity_ = 0;
+  stride_ = 0;
+  version_ = 0;
+  cache_ = nullptr;
 }
 
 S21Matrix::S21Matrix(int rows, int cols) {
   if (rows <= 0 || cols <= 0) {
-    throw "Invalid matrix size";
+    throw S21SizeError("Invalid matrix size");
   }
+  version_ = 0;
+  cache_ = nullptr;
   rows_ = rows;
   cols_ = cols;
   AllocateMatrix();
 }
 
-S21Matrix::S21Matrix(const S21Matrix &other) {
-  rows_ = other.rows_;
-  cols_ = other.cols_;
-  AllocateMatrix();
-  for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      matrix_[i][j] = other.matrix_[i][j];
+S21Matrix::S21Matrix(int rows, int cols, const double *data, S21Layout layout)
+    : S21Matrix(rows, cols) {
+  Assign(data, layout);
+}
+
+S21Matrix::S21Matrix(int rows, int cols, std::initializer_list<double> values)
+    : S21Matrix(rows, cols) {
+  Assign(values.begin(), values.end());
+}
+
+S21Matrix::S21Matrix(std::initializer_list<std::initializer_list<double>> rows)
+    : S21Matrix((int)rows.size(), rows.size() ? (int)rows.begin()->size() : 0) {
+  int i = 0;
+  for (const std::initializer_list<double> &row : rows) {
+    if ((int)row.size() != cols_) {
+      throw S21SizeError("Wrong matrix size");
     }
+    std::copy(row.begin(), row.end(), matrix_[i++]);
   }
 }
 
-S21Matrix::S21Matrix(S21Matrix &&other) {
+S21Matrix::S21Matrix(const S21Matrix &other) {
+  version_ = 0;
+  cache_ = nullptr;
   rows_ = other.rows_;
   cols_ = other.cols_;
   AllocateMatrix();
   for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      matrix_[i][j] = other.matrix_[i][j];
-    }
+    std::copy(other.matrix_[i], other.matrix_[i] + cols_, matrix_[i]);
   }
-  other.~S21Matrix();
 }
 
-S21Matrix::~S21Matrix() {
+S21Matrix S21Matrix::View(double *data, int rows, int cols, int stride) {
+  if (rows <= 0 || cols <= 0 || stride < cols) {
+    throw S21SizeError("Invalid matrix size");
+  }
+  if (data == nullptr) {
+    throw S21ArgumentError("Null data");
+  }
+  S21Matrix view;
+  view.rows_ = rows;
+  view.cols_ = cols;
+  view.row_capacity_ = rows;
+  view.stride_ = stride;
+  view.data_ = data;
+  view.owns_data_ = false;
+  view.matrix_ = new double *[rows];
+  for (int i = 0; i < rows; i++) {
+    view.matrix_[i] = data + (long long)i * stride;
+  }
+  return view;
+}
+
+S21Matrix::S21Matrix(S21Matrix &&other) {
+  matrix_ = nullptr;
+  data_ = nullptr;
+  owns_data_ = true;
+  version_ = 0;
+  cache_ = nullptr;
+  TakeStorage(other);
+}
+
+S21Matrix::~S21Matrix() { Release(); }
+
+void S21Matrix::Release() {
   if (matrix_ != nullptr) {
-    for (int i = 0; i < rows_; i++) {
-      delete[] matrix_[i];
+    if (owns_data_) {
+      S21FreeBuffer(data_);
     }
     delete[] matrix_;
     matrix_ = nullptr;
+    data_ = nullptr;
   }
+  owns_data_ = true;
+  delete cache_.exchange(nullptr);
   rows_ = 0;
   cols_ = 0;
+  row_capacity_ = 0;
+  stride_ = 0;
 }
 
 void S21Matrix::SumMatrix(const S21Matrix &other) {
   if (rows_ != other.rows_ || cols_ != other.cols_) {
-    throw "Wrong matrix size";
+    throw S21SizeError("Wrong matrix size");
   }
+  MarkModified();
   for (int i = 0; i < rows_; i++) {
     for (int j = 0; j < cols_; j++) {
       matrix_[i][j] += other.matrix_[i][j];
@@ -61,7 +125,7 @@ void S21Matrix::SumMatrix(const S21Matrix &other) {
   }
 }
 
-bool S21Matrix::EqMatrix(const S21Matrix &other) {
+bool S21Matrix::EqMatrix(const S21Matrix &other) const {
   bool is_equal = true;
   if (rows_ != other.rows_ || cols_ != other.cols_) {
     is_equal = false;
@@ -79,8 +143,9 @@ bool S21Matrix::EqMatrix(const S21Matrix &other) {
 
 void S21Matrix::SubMatrix(const S21Matrix &other) {
   if (rows_ != other.rows_ || cols_ != other.cols_) {
-    throw "Wrong matrix size";
+    throw S21SizeError("Wrong matrix size");
   }
+  MarkModified();
   for (int i = 0; i < rows_; i++) {
     for (int j = 0; j < cols_; j++) {
       matrix_[i][j] -= other.matrix_[i][j];
@@ -89,6 +154,7 @@ void S21Matrix::SubMatrix(const S21Matrix &other) {
 }
 
 void S21Matrix::MulNumber(const double num) {
+  MarkModified();
   for (int i = 0; i < rows_; i++) {
     for (int j = 0; j < cols_; j++) {
       matrix_[i][j] *= num;
@@ -97,26 +163,13 @@ void S21Matrix::MulNumber(const double num) {
 }
 
 void S21Matrix::MulMatrix(const S21Matrix &other) {
-  if (cols_ != other.rows_ || rows_ != other.cols_) {
-    throw "Wrong size";
-  }
-  S21Matrix temp(*this);
-  this->~S21Matrix();
-  rows_ = temp.rows_;
-  cols_ = other.cols_;
-  AllocateMatrix();
-  for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      double value = 0;
-      for (int k = 0; k < temp.cols_; k++) {
-        value += temp.matrix_[i][k] * other.matrix_[k][j];
-      }
-      matrix_[i][j] = value;
-    }
+  if (cols_ != other.rows_) {
+    throw S21SizeError("Wrong size");
   }
+  Multiply(*this, *this, other);
 }
 
-S21Matrix S21Matrix::Transpose() {
+S21Matrix S21Matrix::Transpose() const {
   S21Matrix result(cols_, rows_);
   for (int i = 0; i < result.rows_; i++) {
     for (int j = 0; j < result.cols_; j++) {
@@ -126,14 +179,14 @@ S21Matrix S21Matrix::Transpose() {
   return result;
 }
 
-S21Matrix S21Matrix::CalcComplements() {
+S21Matrix S21Matrix::CalcComplements() const {
   if (rows_ != cols_) {
-    throw "Matrix not square";
+    throw S21SizeError("Matrix not square");
   }
   S21Matrix result(rows_, cols_);
   if (result.rows_ == 1) {
     if (fabs(matrix_[0][0] < 1e-6)) {
-      throw "Can't calculate complements for this matrix";
+      throw S21SingularError("Can't calculate complements for this matrix");
     } else {
       result.matrix_[0][0] = 1;
     }
@@ -150,50 +203,40 @@ S21Matrix S21Matrix::CalcComplements() {
   return result;
 }
 
-double S21Matrix::Determinant() {
+double S21Matrix::Determinant() const {
   if (rows_ != cols_) {
-    throw "Matrix not square";
+    throw S21SizeError("Matrix not square");
   }
-  double result = 0;
+  // До 3 x 3 явная формула дешевле разложения и точна на целых числах
+  const double *const *m = matrix_;
   if (rows_ == 1) {
-    result = matrix_[0][0];
-  } else if (rows_ == 2) {
-    result = matrix_[0][0] * matrix_[1][1] - matrix_[0][1] * matrix_[1][0];
-  } else {
-    S21Matrix temp(rows_ - 1, cols_ - 1);
-    for (int i = 0; i < cols_; i++) {
-      for (int j = 0; j < temp.rows_; j++) {
-        for (int k = 0; k < i; k++) {
-          temp.matrix_[j][k] = matrix_[j + 1][k];
-        }
-        for (int k = i; k < temp.cols_; k++) {
-          temp.matrix_[j][k] = matrix_[j + 1][k + 1];
-        }
-      }
-      double other_det = temp.Determinant();
-      result += matrix_[0][i] * pow(-1, i + 2) * other_det;
-    }
+    return m[0][0];
   }
-  return result;
+  if (rows_ == 2) {
+    return m[0][0] * m[1][1] - m[0][1] * m[1][0];
+  }
+  if (rows_ == 3) {
+    return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+           m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+           m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+  }
+  return LUDecompose(*this)->determinant;
 }
 
-S21Matrix S21Matrix::InverseMatrix() {
-  double determinant = Determinant();
-  if (determinant == 0) {
-    throw "Null determinant";
-  }
-  S21Matrix result(rows_, cols_);
-  S21Matrix temp(CalcComplements());
-  S21Matrix transposed(temp.Transpose());
-  for (int i = 0; i < result.rows_; i++) {
-    for (int j = 0; j < result.cols_; j++) {
-      result.matrix_[i][j] = transposed.matrix_[i][j] / determinant;
-    }
+S21Matrix S21Matrix::InverseMatrix() const {
+  if (rows_ != cols_) {
+    throw S21SizeError("Matrix not square");
   }
-  return result;
+  // Вырожденность определяет LU-разложение внутри Solve
+  return *S21Memoize<S21Matrix>(
+      *this, S21MatrixCache::kInverse, sizeof(double) * rows_ * cols_, [&] {
+        S21Matrix identity(rows_, cols_);
+        for (int i = 0; i < rows_; i++) identity.matrix_[i][i] = 1;
+        return Solve(*this, identity);
+      });
 }
 
-S21Matrix S21Matrix::GetMinor(int row, int col) {
+S21Matrix S21Matrix::GetMinor(int row, int col) const {
   S21Matrix minor(rows_ - 1, cols_ - 1);
   int m, n;
   for (int i = 0; i < rows_; i++) {
@@ -214,45 +257,51 @@ S21Matrix S21Matrix::GetMinor(int row, int col) {
   return minor;
 }
 
-S21Matrix S21Matrix::operator+(const S21Matrix &other) {
+S21Matrix S21Matrix::operator+(const S21Matrix &other) const {
   S21Matrix result(*this);
   result.SumMatrix(other);
   return result;
 }
 
-S21Matrix S21Matrix::operator-(const S21Matrix &other) {
+S21Matrix S21Matrix::operator-(const S21Matrix &other) const {
   S21Matrix result(*this);
   result.SubMatrix(other);
   return result;
 }
 
-S21Matrix S21Matrix::operator*(const S21Matrix &other) {
+S21Matrix S21Matrix::operator*(const S21Matrix &other) const {
   S21Matrix result(*this);
   result.MulMatrix(other);
   return result;
 }
 
-S21Matrix S21Matrix::operator*(const double num) {
+S21Matrix S21Matrix::operator*(const double num) const {
   S21Matrix result(*this);
   result.MulNumber(num);
   return result;
 }
 
-bool S21Matrix::operator==(const S21Matrix &other) { return EqMatrix(other); }
+bool S21Matrix::operator==(const S21Matrix &other) const {
+  return EqMatrix(other);
+}
 
 S21Matrix &S21Matrix::operator=(const S21Matrix &other) {
-  this->~S21Matrix();
-  rows_ = other.rows_;
-  cols_ = other.cols_;
-  AllocateMatrix();
-  for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < cols_; j++) {
-      matrix_[i][j] = other.matrix_[i][j];
+  if (this != &other) {
+    Reallocate(other.rows_, other.cols_);
+    for (int i = 0; i < rows_; i++) {
+      std::copy(other.matrix_[i], other.matrix_[i] + cols_, matrix_[i]);
     }
   }
   return *this;
 }
 
+S21Matrix &S21Matrix::operator=(S21Matrix &&other) {
+  if (this != &other) {
+    TakeStorage(other);
+  }
+  return *this;
+}
+
 void S21Matrix::operator+=(const S21Matrix &other) { SumMatrix(other); }
 
 void S21Matrix::operator-=(const S21Matrix &other) { SubMatrix(other); }
@@ -263,30 +312,412 @@ void S21Matrix::operator*=(const double num) { this->MulNumber(num); }
 
 double &S21Matrix::operator()(int i, int j) {
   if (i < 0 || i > this->rows_ - 1 || j < 0 || j > cols_ - 1) {
-    throw "Index out of range";
+    throw S21IndexError("Index out of range");
   }
+  MarkModified();
   return matrix_[i][j];
 }
 
-double S21Matrix::GetMatrixMember(int row, int col) {
+double S21Matrix::operator()(int i, int j) const {
+  if (i < 0 || i > this->rows_ - 1 || j < 0 || j > cols_ - 1) {
+    throw S21IndexError("Index out of range");
+  }
+  return matrix_[i][j];
+}
+
+double S21Matrix::GetMatrixMember(int row, int col) const {
   return matrix_[row][col];
 }
 
-int S21Matrix::GetRows() { return rows_; }
+int S21Matrix::GetRows() const { return rows_; }
+
+int S21Matrix::GetCols() const { return cols_; }
+
+double *S21Matrix::GetRowData(int row) {
+  MarkModified();
+  return matrix_[row];
+}
+
+const double *S21Matrix::GetRowData(int row) const { return matrix_[row]; }
 
-int S21Matrix::GetCols() { return cols_; }
+double *S21Matrix::GetData() {
+  MarkModified();
+  return data_;
+}
+
+const double *S21Matrix::GetData() const { return data_; }
+
+unsigned long long S21Matrix::GetVersion() const {
+  return version_.load(std::memory_order_relaxed);
+}
+
+S21MatrixCache &S21Matrix::GetCache() const {
+  S21MatrixCache *cache = cache_.load();
+  if (cache == nullptr) {
+    S21MatrixCache *created = new S21MatrixCache();
+    if (cache_.compare_exchange_strong(cache, created)) {
+      cache = created;
+    } else {
+      delete created;
+    }
+  }
+  return *cache;
+}
+
+int S21Matrix::GetStride() const { return stride_; }
+
+int S21Matrix::GetRowCapacity() const { return row_capacity_; }
 
 void S21Matrix::SetMatrixMember(int row, int col, double value) {
+  MarkModified();
   matrix_[row][col] = value;
 }
 
-void S21Matrix::SetRows(int value) { rows_ = value; }
+void S21Matrix::SetRows(int value) { Resize(value, cols_); }
 
-void S21Matrix::SetCols(int value) { cols_ = value; }
+void S21Matrix::SetCols(int value) { Resize(rows_, value); }
 
 void S21Matrix::AllocateMatrix() {
+  MarkModified();
+  row_capacity_ = rows_;
+  stride_ = cols_;
+  data_ = S21AllocateBuffer((size_t)rows_ * cols_);
+  owns_data_ = true;
   matrix_ = new double *[rows_]();
   for (int i = 0; i < rows_; i++) {
-    matrix_[i] = new double[cols_]();
+    matrix_[i] = data_ + (long long)i * cols_;
+  }
+  FirstTouch();
+}
+
+void S21Matrix::Resize(int rows, int cols) {
+  if (rows < 0 || cols < 0) {
+    throw S21SizeError("Invalid matrix size");
+  }
+  MarkModified();
+  if (rows > row_capacity_ || cols > stride_) {
+    Regrow(std::max(rows, row_capacity_), std::max(cols, stride_));
+  }
+  // Место за старой границей могло остаться от прежних данных
+  for (int i = 0; i < std::min(rows, rows_); i++) {
+    std::fill(matrix_[i] + std::min(cols, cols_), matrix_[i] + cols, 0.0);
+  }
+  for (int i = rows_; i < rows; i++) {
+    std::fill(matrix_[i], matrix_[i] + cols, 0.0);
+  }
+  rows_ = rows;
+  cols_ = cols;
+}
+
+void S21Matrix::Reserve(int rows, int cols) {
+  if (rows > row_capacity_ || cols > stride_) {
+    Regrow(std::max(rows, row_capacity_), std::max(cols, stride_));
+  }
+}
+
+void S21Matrix::ShrinkToFit() {
+  if (rows_ != row_capacity_ || cols_ != stride_) {
+    Regrow(rows_, cols_);
+  }
+}
+
+void S21Matrix::AppendRows(const S21Matrix &other) {
+  if (rows_ == 0 && cols_ == 0) {
+    cols_ = other.cols_;
+  }
+  if (other.cols_ != cols_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  int count = other.rows_;
+  MarkModified();
+  Grow(rows_ + count, cols_);
+  // other может совпадать с *this, поэтому строки берутся после Grow
+  for (int i = 0; i < count; i++) {
+    std::copy(other.matrix_[i], other.matrix_[i] + cols_, matrix_[rows_ + i]);
+  }
+  rows_ += count;
+}
+
+void S21Matrix::AppendRows(const double *data, int count) {
+  if (count < 0 || cols_ <= 0) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  MarkModified();
+  Grow(rows_ + count, cols_);
+  for (int i = 0; i < count; i++) {
+    const double *source = data + (long long)i * cols_;
+    std::copy(source, source + cols_, matrix_[rows_ + i]);
+  }
+  rows_ += count;
+}
+
+void S21Matrix::AppendCols(const S21Matrix &other) {
+  if (rows_ == 0 && cols_ == 0) {
+    rows_ = other.rows_;
+  }
+  if (other.rows_ != rows_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  int count = other.cols_;
+  MarkModified();
+  Grow(rows_, cols_ + count);
+  for (int i = 0; i < rows_; i++) {
+    std::copy(other.matrix_[i], other.matrix_[i] + count,
+              matrix_[i] + cols_);
+  }
+  cols_ += count;
+}
+
+void S21Matrix::Grow(int rows, int cols) {
+  if (rows > row_capacity_ || cols > stride_) {
+    Regrow(rows > row_capacity_ ? std::max(rows, 2 * row_capacity_)
+                                : row_capacity_,
+           cols > stride_ ? std::max(cols, 2 * stride_) : stride_);
+  }
+}
+
+void S21Matrix::Regrow(int row_capacity, int stride) {
+  double *data = S21AllocateBuffer((size_t)row_capacity * stride);
+  double **matrix = new double *[row_capacity]();
+  for (int i = 0; i < row_capacity; i++) {
+    matrix[i] = data + (long long)i * stride;
+  }
+  int rows = std::min({rows_, row_capacity_, row_capacity});
+  int cols = std::min({cols_, stride_, stride});
+  double **old_matrix = matrix_;
+  double *old_data = data_;
+  bool owned = owns_data_;
+  data_ = data;
+  owns_data_ = true;
+  matrix_ = matrix;
+  row_capacity_ = row_capacity;
+  stride_ = stride;
+  FirstTouch();
+  for (int i = 0; i < rows; i++) {
+    std::copy(old_matrix[i], old_matrix[i] + cols, matrix_[i]);
+  }
+  if (owned) {
+    S21FreeBuffer(old_data);
+  }
+  delete[] old_matrix;
+}
+
+void S21Matrix::FirstTouch() {
+  if (row_capacity_ <= 0 || stride_ <= 0) {
+    return;
+  }
+  // Те же куски строк, что и в ParallelRows, поэтому страницы оказываются у
+  // потоков, которые потом их обрабатывают
+  int grain = std::max(1, S21GetTuning().parallel_elements / stride_);
+  S21ThreadPool::Instance().ParallelFor(
+      0, row_capacity_, grain, [this](int from, int to) {
+        std::fill(matrix_[from], matrix_[to - 1] + stride_, 0.0);
+      });
+}
+
+void S21Matrix::Assign(const double *data, S21Layout layout) {
+  MarkModified();
+  ParallelRows([&](int from, int to) {
+    for (int i = from; i < to; i++) {
+      double *row = matrix_[i];
+      if (layout == S21Layout::kRowMajor) {
+        const double *source = data + (long long)i * cols_;
+        std::copy(source, source + cols_, row);
+        continue;
+      }
+      for (int j = 0; j < cols_; j++) {
+        row[j] = data[(long long)j * rows_ + i];
+      }
+    }
+  });
+}
+
+void S21Matrix::CopyTo(double *out, S21Layout layout) const {
+  ParallelRows([&](int from, int to) {
+    for (int i = from; i < to; i++) {
+      if (layout == S21Layout::kRowMajor) {
+        std::copy(matrix_[i], matrix_[i] + cols_, out + (long long)i * cols_);
+        continue;
+      }
+      const double *row = matrix_[i];
+      for (int j = 0; j < cols_; j++) {
+        out[(long long)j * rows_ + i] = row[j];
+      }
+    }
+  });
+}
+
+void S21Matrix::Fill(double value) {
+  MarkModified();
+  ParallelRows([&](int from, int to) {
+    for (int i = from; i < to; i++) {
+      std::fill(matrix_[i], matrix_[i] + cols_, value);
+    }
+  });
+}
+
+void S21Matrix::ParallelRows(const std::function<void(int, int)> &body) const {
+  if (rows_ <= 0 || cols_ <= 0) {
+    return;
   }
-}
\ No newline at end of file
+  int grain = std::max(1, S21GetTuning().parallel_elements / stride_);
+  S21ThreadPool::Instance().ParallelFor(0, rows_, grain, body);
+}
+void S21Matrix::TakeStorage(S21Matrix &other) {
+  unsigned long long version =
+      std::max(version_.load(std::memory_order_relaxed),
+               other.version_.load(std::memory_order_relaxed)) +
+      1;
+  Release();
+  version_ = version;
+  rows_ = other.rows_;
+  cols_ = other.cols_;
+  matrix_ = other.matrix_;
+  data_ = other.data_;
+  owns_data_ = other.owns_data_;
+  row_capacity_ = other.row_capacity_;
+  stride_ = other.stride_;
+  other.matrix_ = nullptr;
+  other.data_ = nullptr;
+  other.Release();
+}
+
+void S21Matrix::Reallocate(int rows, int cols) {
+  MarkModified();
+  if (matrix_ != nullptr && rows <= row_capacity_ && cols <= stride_) {
+    rows_ = rows;
+    cols_ = cols;
+    return;
+  }
+  Release();
+  rows_ = rows;
+  cols_ = cols;
+  AllocateMatrix();
+}
+
+// Строки out делятся между потоками, внутри куска перебираются тайлы b, чтобы
+// тайл оставался в кэше для всех строк куска. Для каждого элемента слагаемые
+// идут в том же порядке по p, что и в простом варианте, поэтому результаты
+// совпадают побитно
+void S21Matrix::MultiplyBlocked(S21Matrix &out, const S21Matrix &a,
+                                const S21Matrix &b, double alpha, double beta,
+                                bool trans_a, int tile, int grain) {
+  int m = out.rows_;
+  int n = out.cols_;
+  int k = b.rows_;
+  S21ThreadPool::Instance().ParallelFor(0, m, grain, [&](int from, int to) {
+    for (int i = from; i < to; i++) {
+      double *row = out.matrix_[i];
+      for (int j = 0; j < n; j++) {
+        row[j] = beta == 0 ? 0 : beta * row[j];
+      }
+    }
+    for (int p0 = 0; p0 < k; p0 += tile) {
+      int p1 = std::min(k, p0 + tile);
+      for (int j0 = 0; j0 < n; j0 += tile) {
+        int j1 = std::min(n, j0 + tile);
+        for (int i = from; i < to; i++) {
+          double *row = out.matrix_[i];
+          for (int p = p0; p < p1; p++) {
+            double a_value =
+                alpha * (trans_a ? a.matrix_[p][i] : a.matrix_[i][p]);
+            const double *b_row = b.matrix_[p];
+            for (int j = j0; j < j1; j++) {
+              row[j] += a_value * b_row[j];
+            }
+          }
+        }
+      }
+    }
+  });
+}
+
+void Multiply(S21Matrix &out, const S21Matrix &a, const S21Matrix &b,
+              double alpha, double beta, bool trans_a, bool trans_b) {
+  int m = trans_a ? a.cols_ : a.rows_;
+  int k = trans_a ? a.rows_ : a.cols_;
+  int n = trans_b ? b.rows_ : b.cols_;
+  if (k != (trans_b ? b.cols_ : b.rows_)) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  if (beta != 0 && (out.rows_ != m || out.cols_ != n)) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  if (&out == &a || &out == &b) {
+    // Результат считается в буфер потока, который затем обменивается памятью
+    // с out: старая память out становится буфером для следующего вызова, и
+    // умножение на месте того же размера больше не выделяет память
+    thread_local S21Matrix scratch;
+    if (beta != 0) {
+      scratch = out;
+    }
+    Multiply(scratch, a, b, alpha, beta, trans_a, trans_b);
+    std::swap(out, scratch);
+    return;
+  }
+  out.Reallocate(m, n);
+  S21TuningParameters tuning = S21GetTuning();
+  if (!trans_b && (long long)m * n * k >= tuning.blocked_multiply_min) {
+    int grain = std::max(1, tuning.parallel_elements / std::max(1, n));
+    S21Matrix::MultiplyBlocked(out, a, b, alpha, beta, trans_a,
+                               tuning.multiply_tile, grain);
+    return;
+  }
+  for (int i = 0; i < m; i++) {
+    double *row = out.matrix_[i];
+    for (int j = 0; j < n; j++) {
+      row[j] = beta == 0 ? 0 : beta * row[j];
+    }
+    if (trans_b) {
+      for (int j = 0; j < n; j++) {
+        const double *b_row = b.matrix_[j];
+        double value = 0;
+        for (int p = 0; p < k; p++) {
+          value += (trans_a ? a.matrix_[p][i] : a.matrix_[i][p]) * b_row[p];
+        }
+        row[j] += alpha * value;
+      }
+    } else {
+      for (int p = 0; p < k; p++) {
+        double a_value = alpha * (trans_a ? a.matrix_[p][i] : a.matrix_[i][p]);
+        const double *b_row = b.matrix_[p];
+        for (int j = 0; j < n; j++) {
+          row[j] += a_value * b_row[j];
+        }
+      }
+    }
+  }
+}
+
+void Add(S21Matrix &out, const S21Matrix &a, const S21Matrix &b) {
+  if (a.rows_ != b.rows_ || a.cols_ != b.cols_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  out.Reallocate(a.rows_, a.cols_);
+  for (int i = 0; i < out.rows_; i++) {
+    for (int j = 0; j < out.cols_; j++) {
+      out.matrix_[i][j] = a.matrix_[i][j] + b.matrix_[i][j];
+    }
+  }
+}
+
+void Sub(S21Matrix &out, const S21Matrix &a, const S21Matrix &b) {
+  if (a.rows_ != b.rows_ || a.cols_ != b.cols_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  out.Reallocate(a.rows_, a.cols_);
+  for (int i = 0; i < out.rows_; i++) {
+    for (int j = 0; j < out.cols_; j++) {
+      out.matrix_[i][j] = a.matrix_[i][j] - b.matrix_[i][j];
+    }
+  }
+}
+
+void Scale(S21Matrix &out, const S21Matrix &a, double num) {
+  out.Reallocate(a.rows_, a.cols_);
+  for (int i = 0; i < out.rows_; i++) {
+    for (int j = 0; j < out.cols_; j++) {
+      out.matrix_[i][j] = a.matrix_[i][j] * num;
+    }
+  }
+}
@@ -3,11 +3,38 @@
 
 #include <math.h>
 
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+
+#include "s21_matrix_error.h"
+
+class S21MatrixCache;
+
+// Порядок элементов во внешнем буфере
+enum class S21Layout { kRowMajor, kColumnMajor };
+
 class S21Matrix {
  private:
   int rows_, cols_;
   // Pointer to the memory where the matrix is allocated
   double **matrix_;
+  // Все элементы лежат одним блоком построчно, matrix_[i] указывает внутрь
+  double *data_;
+  // false у представления над чужим блоком (View): его не освобождают
+  bool owns_data_;
+  // Блок рассчитан на row_capacity_ строк по stride_ элементов, лишнее место
+  // позволяет дописывать строки и столбцы без копирования
+  int row_capacity_, stride_;
+  // Растет при каждом изменении элементов или размера. Атомарный, потому что
+  // неконстантные operator(), GetRowData и GetData увеличивают его и могут
+  // вызываться из нескольких потоков для разных элементов
+  std::atomic<unsigned long long> version_;
+  // Создается при первом обращении, см. s21_matrix_cache.h
+  mutable std::atomic<S21MatrixCache *> cache_;
 
  public:
   // Базовый конструктор, инициализирующий матрицу некоторой заранее заданной
@@ -15,6 +42,22 @@ class S21Matrix {
   S21Matrix();
   // Параметризированный конструктор с количеством строк и столбцов
   S21Matrix(int rows, int cols);
+  // Матрица из внешнего буфера с rows * cols элементами
+  S21Matrix(int rows, int cols, const double *data,
+            S21Layout layout = S21Layout::kRowMajor);
+  // Матрица из последовательности [first, last) с rows * cols элементами
+  template <class InputIt>
+  S21Matrix(int rows, int cols, InputIt first, InputIt last,
+            S21Layout layout = S21Layout::kRowMajor);
+  // Матрица из списка значений, записанных построчно
+  S21Matrix(int rows, int cols, std::initializer_list<double> values);
+  // Матрица из списка строк: S21Matrix m{{1, 2}, {3, 4}}
+  S21Matrix(std::initializer_list<std::initializer_list<double>> rows);
+  // Представление над чужим блоком rows x cols, строка i начинается с data +
+  // i * stride. Элементы не копируются и не освобождаются, блок должен жить
+  // дольше матрицы. Копия представления владеет своими данными; изменение
+  // размера сверх блока переносит данные в собственную память
+  static S21Matrix View(double *data, int rows, int cols, int stride);
   // Конструктор копирования
   S21Matrix(const S21Matrix &other);
   // Конструктор переноса
@@ -25,34 +68,38 @@ class S21Matrix {
   // Прибавляет вторую матрицы к текущей
   void SumMatrix(const S21Matrix &other);
   // Проверяет матрицы на равенство между собой
-  bool EqMatrix(const S21Matrix &other);
+  bool EqMatrix(const S21Matrix &other) const;
   // Вычитает из текущей матрицы другую
   void SubMatrix(const S21Matrix &other);
   // Умножает текущую матрицу на число
   void MulNumber(const double num);
-  // Умножает текущую матрицу на вторую
+  // Умножает текущую матрицу m x k на вторую k x n
   void MulMatrix(const S21Matrix &other);
   // Создает новую транспонированную матрицу из текущей и возвращает ее
-  S21Matrix Transpose();
+  S21Matrix Transpose() const;
   // Вычисляет матрицу алгебраических дополнений текущей матрицы и возвращает ее
-  S21Matrix CalcComplements();
-  // Вычисляет и возвращает определитель текущей матрицы
-  double Determinant();
-  // Вычисляет и возвращает обратную матрицу
-  S21Matrix InverseMatrix();
+  S21Matrix CalcComplements() const;
+  // Вычисляет и возвращает определитель текущей матрицы: до 3 x 3 по явной
+  // формуле, больше — по закэшированному LU-разложению (s21_matrix_decompose.h)
+  double Determinant() const;
+  // Вычисляет обратную матрицу через LU-разложение. Результат хранится в
+  // кэше, но возвращается копией: попадание в кэш стоит O(n^2)
+  S21Matrix InverseMatrix() const;
 
   // Сложение двух матриц
-  S21Matrix operator+(const S21Matrix &other);
+  S21Matrix operator+(const S21Matrix &other) const;
   // Вычитание одной матрицы из другой
-  S21Matrix operator-(const S21Matrix &other);
+  S21Matrix operator-(const S21Matrix &other) const;
   // Умножение матриц
-  S21Matrix operator*(const S21Matrix &other);
+  S21Matrix operator*(const S21Matrix &other) const;
   // Умножение матрицы на число
-  S21Matrix operator*(const double num);
+  S21Matrix operator*(const double num) const;
   // Проверка на равенство матриц
-  bool operator==(const S21Matrix &other);
+  bool operator==(const S21Matrix &other) const;
   // Присвоение матрице значений другой матрицы
   S21Matrix &operator=(const S21Matrix &other);
+  // Присвоение с переносом памяти другой матрицы
+  S21Matrix &operator=(S21Matrix &&other);
   // Присвоение сложения (`SumMatrix`)
   void operator+=(const S21Matrix &other);
   // Присвоение разности (`SubMatrix`)
@@ -63,21 +110,186 @@ class S21Matrix {
   void operator*=(const double num);
   // Индексация по элементам матрицы
   double &operator()(int i, int j);
+  double operator()(int i, int j) const;
+  // Индексация без проверки границ и исключений для горячих циклов. В
+  // сборке без NDEBUG индексы проверяются через assert. Неконстантный вариант
+  // версию не меняет, поэтому записи из разных потоков в разные элементы не
+  // конфликтуют; после серии записей вызовите MarkModified() один раз
+  double &Unchecked(int i, int j) noexcept;
+  double Unchecked(int i, int j) const noexcept;
+  // Увеличивает версию после изменений через Unchecked или ранее взятые
+  // указатели, чтобы кэш не отдал значения, посчитанные по старому
+  // содержимому
+  void MarkModified() noexcept;
 
-  S21Matrix GetMinor(int row, int col);
+  S21Matrix GetMinor(int row, int col) const;
 
   // accesors
-  double GetMatrixMember(int row, int col);
-  int GetRows();
-  int GetCols();
+  double GetMatrixMember(int row, int col) const;
+  int GetRows() const;
+  int GetCols() const;
+  // Указатель на начало строки без проверки индекса — для вычислительных ядер
+  double *GetRowData(int row);
+  const double *GetRowData(int row) const;
+
+  // Указатель на блок элементов; строка i начинается с GetData() + i *
+  // GetStride()
+  double *GetData();
+  const double *GetData() const;
+  int GetStride() const;
+  int GetRowCapacity() const;
+  // Версия содержимого. Неконстантные методы, включая operator(), GetData и
+  // GetRowData, считаются изменяющими и увеличивают ее, даже если через них
+  // только читают: для чтения берите константную ссылку, иначе кэш
+  // сбрасывается. Версия меняется в момент получения указателя, а не записи
+  // через него; если указатель, взятый раньше, пишет после вычисления,
+  // попавшего в кэш, вызовите MarkModified()
+  unsigned long long GetVersion() const;
+  // Кэш определителя, обратной матрицы, разложений и норм для текущей версии
+  S21MatrixCache &GetCache() const;
 
   // mutators
   void SetMatrixMember(int row, int col, double value);
+  // Меняют размер через Resize, сохраняя данные
   void SetRows(int value);
   void SetCols(int value);
 
+  // Меняет размер с сохранением данных, новые элементы равны нулю
+  void Resize(int rows, int cols);
+  // Выделяет место под rows x cols элементов, не меняя размер
+  void Reserve(int rows, int cols);
+  // Освобождает лишнее место
+  void ShrinkToFit();
+  // Дописывает снизу строки other; запас растет вдвое, поэтому добавление
+  // строки в среднем O(1). Пустая матрица принимает число столбцов other
+  void AppendRows(const S21Matrix &other);
+  // Дописывает count строк из построчного буфера
+  void AppendRows(const double *data, int count);
+  // Дописывает справа столбцы other
+  void AppendCols(const S21Matrix &other);
+
+  // Массовая загрузка и выгрузка. Размер матрицы не меняется, буфер должен
+  // содержать rows * cols элементов
+  void Assign(const double *data, S21Layout layout = S21Layout::kRowMajor);
+  template <class InputIt>
+  void Assign(InputIt first, InputIt last,
+              S21Layout layout = S21Layout::kRowMajor);
+  void CopyTo(double *out, S21Layout layout = S21Layout::kRowMajor) const;
+  // Записывает value во все элементы
+  void Fill(double value);
+  // Записывает generator(i, j) в элемент (i, j); строки заполняются
+  // параллельно, поэтому generator должен быть потокобезопасным
+  template <class Generator>
+  void Generate(Generator generator);
+
   // etc
   void AllocateMatrix();
+
+  // Запись результата в заранее выделенную матрицу-приемник
+  friend void Multiply(S21Matrix &out, const S21Matrix &a, const S21Matrix &b,
+                       double alpha, double beta, bool trans_a, bool trans_b);
+  friend void Add(S21Matrix &out, const S21Matrix &a, const S21Matrix &b);
+  friend void Sub(S21Matrix &out, const S21Matrix &a, const S21Matrix &b);
+  friend void Scale(S21Matrix &out, const S21Matrix &a, double num);
+  friend class S21MatrixChain;
+  friend class S21DiagonalMatrix;
+  friend class S21TriangularMatrix;
+  friend class S21SymmetricMatrix;
+  friend class S21BandedMatrix;
+
+ private:
+  // Меняет размер матрицы, не трогая память, если она уже вмещает новый
+  // размер. Содержимое после вызова не определено
+  void Reallocate(int rows, int cols);
+  // Освобождает память и кэш, оставляя пустую матрицу 0 x 0. Вызывается
+  // вместо деструктора там, где объект продолжает жить
+  void Release();
+  // Забирает память other, оставляя ее пустой
+  void TakeStorage(S21Matrix &other);
+  // Обнуляет весь блок параллельно, кусками как в ParallelRows
+  void FirstTouch();
+  // Переносит данные в новый блок row_capacity x stride
+  void Regrow(int row_capacity, int stride);
+  // Добивается запаса под rows x cols, увеличивая его хотя бы вдвое
+  void Grow(int rows, int cols);
+  // Делит строки на куски и вызывает body(from, to) в пуле потоков
+  void ParallelRows(const std::function<void(int, int)> &body) const;
+  // Умножение с тайлами tile x tile для Multiply без транспонирования b;
+  // out уже имеет нужный размер
+  static void MultiplyBlocked(S21Matrix &out, const S21Matrix &a,
+                              const S21Matrix &b, double alpha, double beta,
+                              bool trans_a, int tile, int grain);
 };
 
+template <class InputIt>
+S21Matrix::S21Matrix(int rows, int cols, InputIt first, InputIt last,
+                     S21Layout layout)
+    : S21Matrix(rows, cols) {
+  Assign(first, last, layout);
+}
+
+template <class InputIt>
+void S21Matrix::Assign(InputIt first, InputIt last, S21Layout layout) {
+  using Category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of<std::random_access_iterator_tag,
+                                Category>::value) {
+    if (std::distance(first, last) != (long long)rows_ * cols_) {
+      S21_THROW(S21SizeError("Wrong matrix size"));
+    }
+  }
+  MarkModified();
+  long long count = 0;
+  long long total = (long long)rows_ * cols_;
+  for (; first != last && count < total; ++first, ++count) {
+    if (layout == S21Layout::kRowMajor) {
+      matrix_[count / cols_][count % cols_] = *first;
+    } else {
+      matrix_[count % rows_][count / rows_] = *first;
+    }
+  }
+  if (count != total || first != last) {
+    S21_THROW(S21SizeError("Wrong matrix size"));
+  }
+}
+
+inline double &S21Matrix::Unchecked(int i, int j) noexcept {
+  assert(i >= 0 && i < rows_ && j >= 0 && j < cols_);
+  return matrix_[i][j];
+}
+
+inline double S21Matrix::Unchecked(int i, int j) const noexcept {
+  assert(i >= 0 && i < rows_ && j >= 0 && j < cols_);
+  return matrix_[i][j];
+}
+
+inline void S21Matrix::MarkModified() noexcept {
+  version_.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <class Generator>
+void S21Matrix::Generate(Generator generator) {
+  MarkModified();
+  ParallelRows([&](int from, int to) {
+    for (int i = from; i < to; i++) {
+      double *row = matrix_[i];
+      for (int j = 0; j < cols_; j++) {
+        row[j] = generator(i, j);
+      }
+    }
+  });
+}
+
+// out = alpha * op(a) * op(b) + beta * out, где op — транспонирование при
+// trans_a/trans_b. Память out переиспользуется, если ее размер совпадает с
+// размером результата; при beta != 0 размер out обязан совпадать
+void Multiply(S21Matrix &out, const S21Matrix &a, const S21Matrix &b,
+              double alpha = 1.0, double beta = 0.0, bool trans_a = false,
+              bool trans_b = false);
+// out = a + b
+void Add(S21Matrix &out, const S21Matrix &a, const S21Matrix &b);
+// out = a - b
+void Sub(S21Matrix &out, const S21Matrix &a, const S21Matrix &b);
+// out = a * num
+void Scale(S21Matrix &out, const S21Matrix &a, double num);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,330 @@
+#include "s21_matrix_reduce.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "s21_matrix_cache.h"
+#include "s21_thread_pool.h"
+#include "s21_tuning.h"
+
+namespace {
+
+// Сумма с компенсацией ошибки округления (алгоритм Ноймайера)
+struct CompensatedSum {
+  double sum = 0;
+  double compensation = 0;
+
+  void Add(double value) {
+    double total = sum + value;
+    if (fabs(sum) >= fabs(value)) {
+      compensation += (sum - total) + value;
+    } else {
+      compensation += (value - total) + sum;
+    }
+    sum = total;
+  }
+  void Add(const CompensatedSum &other) {
+    Add(other.sum);
+    compensation += other.compensation;
+  }
+  double Result() const { return sum + compensation; }
+};
+
+// Четыре аккумулятора разрывают зависимость между итерациями и дают
+// компилятору векторизовать цикл
+double RowSum(const double *row, int cols) {
+  double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  int j = 0;
+  for (; j + 4 <= cols; j += 4) {
+    s0 += row[j];
+    s1 += row[j + 1];
+    s2 += row[j + 2];
+    s3 += row[j + 3];
+  }
+  for (; j < cols; j++) s0 += row[j];
+  return (s0 + s1) + (s2 + s3);
+}
+
+double RowDot(const double *a, const double *b, int cols) {
+  double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  int j = 0;
+  for (; j + 4 <= cols; j += 4) {
+    s0 += a[j] * b[j];
+    s1 += a[j + 1] * b[j + 1];
+    s2 += a[j + 2] * b[j + 2];
+    s3 += a[j + 3] * b[j + 3];
+  }
+  for (; j < cols; j++) s0 += a[j] * b[j];
+  return (s0 + s1) + (s2 + s3);
+}
+
+double RowAbsSum(const double *row, int cols) {
+  double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  int j = 0;
+  for (; j + 4 <= cols; j += 4) {
+    s0 += fabs(row[j]);
+    s1 += fabs(row[j + 1]);
+    s2 += fabs(row[j + 2]);
+    s3 += fabs(row[j + 3]);
+  }
+  for (; j < cols; j++) s0 += fabs(row[j]);
+  return (s0 + s1) + (s2 + s3);
+}
+
+// Делит строки на куски фиксированного размера, сворачивает каждый кусок
+// reduce(from, to) в пуле потоков и складывает частичные результаты деревом.
+// Разбиение не зависит от числа потоков, поэтому результат детерминирован
+template <class Partial, class Reduce, class Combine>
+Partial ReduceRows(const S21Matrix &a, Reduce reduce, Combine combine) {
+  int rows = a.GetRows();
+  int block_rows = std::max(
+      1, S21GetTuning().reduce_block_elements / std::max(1, a.GetCols()));
+  int blocks = (rows + block_rows - 1) / block_rows;
+  if (blocks <= 1) {
+    return reduce(0, rows);
+  }
+  std::vector<Partial> partials(blocks);
+  S21ThreadPool::Instance().ParallelFor(0, blocks, 1, [&](int from, int to) {
+    for (int block = from; block < to; block++) {
+      partials[block] = reduce(block * block_rows,
+                               std::min(rows, (block + 1) * block_rows));
+    }
+  });
+  for (int step = 1; step < blocks; step *= 2) {
+    for (int block = 0; block + step < blocks; block += 2 * step) {
+      partials[block] = combine(partials[block], partials[block + step]);
+    }
+  }
+  return partials[0];
+}
+
+double AddPartials(double a, double b) { return a + b; }
+
+std::vector<double> AddColumns(std::vector<double> a,
+                               const std::vector<double> &b) {
+  for (size_t j = 0; j < a.size(); j++) a[j] += b[j];
+  return a;
+}
+
+// Суммы по столбцам (при absolute — сумм модулей)
+std::vector<double> ColumnTotals(const S21Matrix &a, bool absolute) {
+  int cols = a.GetCols();
+  return ReduceRows<std::vector<double>>(
+      a,
+      [&](int from, int to) {
+        std::vector<double> totals(cols, 0);
+        for (int i = from; i < to; i++) {
+          const double *row = a.GetRowData(i);
+          if (absolute) {
+            for (int j = 0; j < cols; j++) totals[j] += fabs(row[j]);
+          } else {
+            for (int j = 0; j < cols; j++) totals[j] += row[j];
+          }
+        }
+        return totals;
+      },
+      AddColumns);
+}
+
+void CheckNotEmpty(const S21Matrix &a) {
+  if (a.GetRows() <= 0 || a.GetCols() <= 0) {
+    throw S21SizeError("Empty matrix");
+  }
+}
+
+}  // namespace
+
+double Sum(const S21Matrix &a, bool compensated) {
+  int cols = a.GetCols();
+  if (compensated) {
+    return ReduceRows<CompensatedSum>(
+               a,
+               [&](int from, int to) {
+                 CompensatedSum result;
+                 for (int i = from; i < to; i++) {
+                   const double *row = a.GetRowData(i);
+                   for (int j = 0; j < cols; j++) result.Add(row[j]);
+                 }
+                 return result;
+               },
+               [](CompensatedSum x, const CompensatedSum &y) {
+                 x.Add(y);
+                 return x;
+               })
+        .Result();
+  }
+  return ReduceRows<double>(
+      a,
+      [&](int from, int to) {
+        double result = 0;
+        for (int i = from; i < to; i++) result += RowSum(a.GetRowData(i), cols);
+        return result;
+      },
+      AddPartials);
+}
+
+double Dot(const S21Matrix &a, const S21Matrix &b, bool compensated) {
+  if (a.GetRows() != b.GetRows() || a.GetCols() != b.GetCols()) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  int cols = a.GetCols();
+  if (compensated) {
+    return ReduceRows<CompensatedSum>(
+               a,
+               [&](int from, int to) {
+                 CompensatedSum result;
+                 for (int i = from; i < to; i++) {
+                   const double *a_row = a.GetRowData(i);
+                   const double *b_row = b.GetRowData(i);
+                   for (int j = 0; j < cols; j++) {
+                     result.Add(a_row[j] * b_row[j]);
+                   }
+                 }
+                 return result;
+               },
+               [](CompensatedSum x, const CompensatedSum &y) {
+                 x.Add(y);
+                 return x;
+               })
+        .Result();
+  }
+  return ReduceRows<double>(
+      a,
+      [&](int from, int to) {
+        double result = 0;
+        for (int i = from; i < to; i++) {
+          result += RowDot(a.GetRowData(i), b.GetRowData(i), cols);
+        }
+        return result;
+      },
+      AddPartials);
+}
+
+double FrobeniusNorm(const S21Matrix &a, bool compensated) {
+  if (compensated) {
+    return sqrt(Dot(a, a, true));
+  }
+  return *S21Memoize<double>(a, S21MatrixCache::kFrobeniusNorm,
+                             sizeof(double), [&] { return sqrt(Dot(a, a)); });
+}
+
+double Norm1(const S21Matrix &a) {
+  return *S21Memoize<double>(a, S21MatrixCache::kNorm1, sizeof(double), [&] {
+    std::vector<double> totals = ColumnTotals(a, true);
+    double result = 0;
+    for (double total : totals) result = std::max(result, total);
+    return result;
+  });
+}
+
+double NormInf(const S21Matrix &a) {
+  int cols = a.GetCols();
+  return *S21Memoize<double>(a, S21MatrixCache::kNormInf, sizeof(double), [&] {
+    return ReduceRows<double>(
+        a,
+        [&](int from, int to) {
+          double result = 0;
+          for (int i = from; i < to; i++) {
+            result = std::max(result, RowAbsSum(a.GetRowData(i), cols));
+          }
+          return result;
+        },
+        [](double x, double y) { return std::max(x, y); });
+  });
+}
+
+double MaxAbs(const S21Matrix &a) {
+  int cols = a.GetCols();
+  return ReduceRows<double>(
+      a,
+      [&](int from, int to) {
+        double result = 0;
+        for (int i = from; i < to; i++) {
+          const double *row = a.GetRowData(i);
+          for (int j = 0; j < cols; j++) {
+            result = std::max(result, fabs(row[j]));
+          }
+        }
+        return result;
+      },
+      [](double x, double y) { return std::max(x, y); });
+}
+
+double Min(const S21Matrix &a) { return Statistics(a).min; }
+
+double Max(const S21Matrix &a) { return Statistics(a).max; }
+
+double Trace(const S21Matrix &a) {
+  if (a.GetRows() != a.GetCols()) {
+    throw S21SizeError("Matrix not square");
+  }
+  double result = 0;
+  for (int i = 0; i < a.GetRows(); i++) result += a.GetRowData(i)[i];
+  return result;
+}
+
+void RowSums(S21Matrix &out, const S21Matrix &a) {
+  if (&out == &a) {
+    // Смена размера out освободила бы строки a до того, как они прочитаны
+    S21Matrix temp;
+    RowSums(temp, a);
+    out = std::move(temp);
+    return;
+  }
+  int rows = a.GetRows();
+  int cols = a.GetCols();
+  if (out.GetRows() != rows || out.GetCols() != 1) {
+    out = S21Matrix(rows, 1);
+  }
+  // Неконстантный доступ меняет версию out, поэтому адрес берется до запуска
+  // потоков
+  double *sums = out.GetData();
+  int stride = out.GetStride();
+  int grain =
+      std::max(1, S21GetTuning().parallel_elements / std::max(1, cols));
+  S21ThreadPool::Instance().ParallelFor(0, rows, grain, [&](int from, int to) {
+    for (int i = from; i < to; i++) {
+      sums[(long long)i * stride] = RowSum(a.GetRowData(i), cols);
+    }
+  });
+}
+
+void ColSums(S21Matrix &out, const S21Matrix &a) {
+  std::vector<double> totals = ColumnTotals(a, false);
+  if (out.GetRows() != 1 || out.GetCols() != a.GetCols()) {
+    out = S21Matrix(1, a.GetCols());
+  }
+  std::copy(totals.begin(), totals.end(), out.GetRowData(0));
+}
+
+S21MatrixStats Statistics(const S21Matrix &a) {
+  CheckNotEmpty(a);
+  int cols = a.GetCols();
+  return ReduceRows<S21MatrixStats>(
+      a,
+      [&](int from, int to) {
+        const double *first = a.GetRowData(from);
+        S21MatrixStats result = {0, 0, first[0], first[0], 0};
+        for (int i = from; i < to; i++) {
+          const double *row = a.GetRowData(i);
+          result.sum += RowSum(row, cols);
+          result.sum_squares += RowDot(row, row, cols);
+          for (int j = 0; j < cols; j++) {
+            result.min = std::min(result.min, row[j]);
+            result.max = std::max(result.max, row[j]);
+          }
+        }
+        result.max_abs = std::max(fabs(result.min), fabs(result.max));
+        return result;
+      },
+      [](S21MatrixStats x, const S21MatrixStats &y) {
+        x.sum += y.sum;
+        x.sum_squares += y.sum_squares;
+        x.min = std::min(x.min, y.min);
+        x.max = std::max(x.max, y.max);
+        x.max_abs = std::max(x.max_abs, y.max_abs);
+        return x;
+      });
+}
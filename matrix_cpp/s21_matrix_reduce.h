@@ -0,0 +1,38 @@
+#ifndef S21_MATRIX_REDUCE_H
+#define S21_MATRIX_REDUCE_H
+
+#include "s21_matrix_oop.h"
+
+// Свертки матрицы. Строки обрабатываются с несколькими независимыми
+// аккумуляторами, большие матрицы делятся по строкам между потоками пула, а
+// частичные результаты складываются попарно, так что ответ не зависит от
+// числа потоков. При compensated = true суммирование идет по Ноймайеру
+
+// Несколько статистик за один проход по матрице
+struct S21MatrixStats {
+  double sum;
+  double sum_squares;
+  double min;
+  double max;
+  double max_abs;
+};
+
+double Sum(const S21Matrix &a, bool compensated = false);
+// Скалярное произведение матриц как векторов: сумма a(i, j) * b(i, j)
+double Dot(const S21Matrix &a, const S21Matrix &b, bool compensated = false);
+double FrobeniusNorm(const S21Matrix &a, bool compensated = false);
+// Максимальная по столбцам сумма модулей
+double Norm1(const S21Matrix &a);
+// Максимальная по строкам сумма модулей
+double NormInf(const S21Matrix &a);
+double MaxAbs(const S21Matrix &a);
+double Min(const S21Matrix &a);
+double Max(const S21Matrix &a);
+double Trace(const S21Matrix &a);
+// out — столбец rows x 1 с суммами строк
+void RowSums(S21Matrix &out, const S21Matrix &a);
+// out — строка 1 x cols с суммами столбцов
+void ColSums(S21Matrix &out, const S21Matrix &a);
+S21MatrixStats Statistics(const S21Matrix &a);
+
+#endif
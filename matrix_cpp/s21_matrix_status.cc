@@ -0,0 +1,160 @@
+#include "s21_matrix_status.h"
+
+#include <new>
+
+#include "s21_matrix_decompose.h"
+
+namespace {
+
+// Размеры проверяются заранее, так что исключения доходят сюда только из
+// глубины вычислений или при нехватке памяти
+template <class F>
+S21Status Guard(F body) noexcept {
+  try {
+    body();
+    return S21Status::kOk;
+  } catch (const S21MatrixError &error) {
+    return error.GetStatus();
+  } catch (const std::bad_alloc &) {
+    return S21Status::kOutOfMemory;
+  } catch (...) {
+    return S21Status::kSystemError;
+  }
+}
+
+bool IsSquare(const S21Matrix &a) {
+  return a.GetRows() > 0 && a.GetRows() == a.GetCols();
+}
+
+bool InRange(const S21Matrix &a, int row, int col) {
+  return row >= 0 && row < a.GetRows() && col >= 0 && col < a.GetCols();
+}
+
+// kSingular, если LU-разложение a отметило неполный ранг. Разложение
+// запоминается, Solve его не пересчитывает
+S21Status CheckRegular(const S21Matrix &a) noexcept {
+  bool singular = false;
+  S21Status status = Guard([&] { singular = LUDecompose(a)->singular; });
+  if (status != S21Status::kOk) {
+    return status;
+  }
+  return singular ? S21Status::kSingular : S21Status::kOk;
+}
+
+}  // namespace
+
+S21Expected<S21Matrix> TryCreate(int rows, int cols) noexcept {
+  if (rows <= 0 || cols <= 0) {
+    return S21Status::kSizeError;
+  }
+  S21Matrix result;
+  S21Status status = Guard([&] { result = S21Matrix(rows, cols); });
+  if (status != S21Status::kOk) {
+    return status;
+  }
+  return S21Expected<S21Matrix>(std::move(result));
+}
+
+S21Expected<double> TryGetMember(const S21Matrix &a, int row,
+                                 int col) noexcept {
+  if (!InRange(a, row, col)) {
+    return S21Status::kIndexError;
+  }
+  return a.Unchecked(row, col);
+}
+
+S21Status TrySetMember(S21Matrix &a, int row, int col, double value) noexcept {
+  if (!InRange(a, row, col)) {
+    return S21Status::kIndexError;
+  }
+  a.Unchecked(row, col) = value;
+  a.MarkModified();
+  return S21Status::kOk;
+}
+
+S21Status TryResize(S21Matrix &a, int rows, int cols) noexcept {
+  if (rows < 0 || cols < 0) {
+    return S21Status::kSizeError;
+  }
+  return Guard([&] { a.Resize(rows, cols); });
+}
+
+S21Status TryAdd(S21Matrix &out, const S21Matrix &a,
+                 const S21Matrix &b) noexcept {
+  if (a.GetRows() != b.GetRows() || a.GetCols() != b.GetCols()) {
+    return S21Status::kSizeError;
+  }
+  return Guard([&] { Add(out, a, b); });
+}
+
+S21Status TrySub(S21Matrix &out, const S21Matrix &a,
+                 const S21Matrix &b) noexcept {
+  if (a.GetRows() != b.GetRows() || a.GetCols() != b.GetCols()) {
+    return S21Status::kSizeError;
+  }
+  return Guard([&] { Sub(out, a, b); });
+}
+
+S21Status TryMultiply(S21Matrix &out, const S21Matrix &a, const S21Matrix &b,
+                      double alpha, double beta, bool trans_a,
+                      bool trans_b) noexcept {
+  int m = trans_a ? a.GetCols() : a.GetRows();
+  int k = trans_a ? a.GetRows() : a.GetCols();
+  int n = trans_b ? b.GetRows() : b.GetCols();
+  if (k != (trans_b ? b.GetCols() : b.GetRows()) ||
+      (beta != 0 && (out.GetRows() != m || out.GetCols() != n))) {
+    return S21Status::kSizeError;
+  }
+  return Guard([&] { Multiply(out, a, b, alpha, beta, trans_a, trans_b); });
+}
+
+S21Expected<double> TryDeterminant(const S21Matrix &a) noexcept {
+  if (!IsSquare(a)) {
+    return S21Status::kSizeError;
+  }
+  double determinant = 0;
+  S21Status status =
+      Guard([&] { determinant = LUDecompose(a)->determinant; });
+  if (status != S21Status::kOk) {
+    return status;
+  }
+  return determinant;
+}
+
+S21Expected<S21Matrix> TryInverse(const S21Matrix &a) noexcept {
+  if (!IsSquare(a)) {
+    return S21Status::kSizeError;
+  }
+  S21Status regular = CheckRegular(a);
+  if (regular != S21Status::kOk) {
+    return regular;
+  }
+  int n = a.GetRows();
+  S21Matrix result;
+  S21Status status = Guard([&] {
+    S21Matrix identity(n, n);
+    for (int i = 0; i < n; i++) identity.Unchecked(i, i) = 1;
+    result = Solve(a, identity);
+  });
+  if (status != S21Status::kOk) {
+    return status;
+  }
+  return S21Expected<S21Matrix>(std::move(result));
+}
+
+S21Expected<S21Matrix> TrySolve(const S21Matrix &a,
+                                const S21Matrix &b) noexcept {
+  if (!IsSquare(a) || b.GetRows() != a.GetRows() || b.GetCols() <= 0) {
+    return S21Status::kSizeError;
+  }
+  S21Status regular = CheckRegular(a);
+  if (regular != S21Status::kOk) {
+    return regular;
+  }
+  S21Matrix result;
+  S21Status status = Guard([&] { result = Solve(a, b); });
+  if (status != S21Status::kOk) {
+    return status;
+  }
+  return S21Expected<S21Matrix>(std::move(result));
+}
@@ -0,0 +1,68 @@
+#ifndef S21_MATRIX_STATUS_H
+#define S21_MATRIX_STATUS_H
+
+#include <cassert>
+#include <optional>
+#include <utility>
+
+#include "s21_matrix_error.h"
+#include "s21_matrix_oop.h"
+
+// API без исключений: ошибки возвращаются кодом S21Status, а не бросаются.
+// Заголовок можно подключать в код, собранный с -fno-exceptions
+
+// Значение или код ошибки, как std::expected
+template <class T>
+class S21Expected {
+ public:
+  S21Expected(T value) : status_(S21Status::kOk), value_(std::move(value)) {}
+  S21Expected(S21Status status) : status_(status) {
+    assert(status != S21Status::kOk);
+  }
+
+  bool HasValue() const noexcept { return value_.has_value(); }
+  explicit operator bool() const noexcept { return HasValue(); }
+  S21Status GetStatus() const noexcept { return status_; }
+
+  // Доступ к значению без проверки; в сборке без NDEBUG — с assert
+  T &Value() noexcept {
+    assert(HasValue());
+    return *value_;
+  }
+  const T &Value() const noexcept {
+    assert(HasValue());
+    return *value_;
+  }
+  T &operator*() noexcept { return Value(); }
+  const T &operator*() const noexcept { return Value(); }
+  T *operator->() noexcept { return &Value(); }
+  const T *operator->() const noexcept { return &Value(); }
+  T ValueOr(T fallback) const { return HasValue() ? *value_ : fallback; }
+
+ private:
+  S21Status status_;
+  std::optional<T> value_;
+};
+
+S21Expected<S21Matrix> TryCreate(int rows, int cols) noexcept;
+S21Expected<double> TryGetMember(const S21Matrix &a, int row,
+                                 int col) noexcept;
+S21Status TrySetMember(S21Matrix &a, int row, int col, double value) noexcept;
+S21Status TryResize(S21Matrix &a, int rows, int cols) noexcept;
+
+// Аналоги Add, Sub и Multiply из s21_matrix_oop.h
+S21Status TryAdd(S21Matrix &out, const S21Matrix &a,
+                 const S21Matrix &b) noexcept;
+S21Status TrySub(S21Matrix &out, const S21Matrix &a,
+                 const S21Matrix &b) noexcept;
+S21Status TryMultiply(S21Matrix &out, const S21Matrix &a, const S21Matrix &b,
+                      double alpha = 1.0, double beta = 0.0,
+                      bool trans_a = false, bool trans_b = false) noexcept;
+
+// Через LU-разложение; kSingular для вырожденной матрицы
+S21Expected<double> TryDeterminant(const S21Matrix &a) noexcept;
+S21Expected<S21Matrix> TryInverse(const S21Matrix &a) noexcept;
+S21Expected<S21Matrix> TrySolve(const S21Matrix &a,
+                                const S21Matrix &b) noexcept;
+
+#endif
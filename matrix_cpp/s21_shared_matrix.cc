@@ -0,0 +1,133 @@
+#include "s21_shared_matrix.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+namespace {
+
+// Слот читателя без активного снимка
+const uint64_t kIdle = std::numeric_limits<uint64_t>::max();
+
+}  // namespace
+
+// Слоты разных читателей лежат в разных кэш-линиях, чтобы читатели не
+// мешали друг другу
+struct alignas(64) S21SharedMatrix::Reader::Slot {
+  std::atomic<uint64_t> epoch{kIdle};
+  // Глубина вложенных снимков; меняется только своим потоком
+  int depth = 0;
+};
+
+S21SharedMatrix::Snapshot::Snapshot(Reader *reader, const Version *version)
+    : reader_(reader), version_(version) {}
+
+S21SharedMatrix::Snapshot::Snapshot(Snapshot &&other) noexcept
+    : reader_(other.reader_), version_(other.version_) {
+  other.reader_ = nullptr;
+  other.version_ = nullptr;
+}
+
+S21SharedMatrix::Snapshot::~Snapshot() {
+  if (reader_) reader_->Release();
+}
+
+const S21Matrix &S21SharedMatrix::Snapshot::operator*() const {
+  return version_->matrix;
+}
+
+const S21Matrix *S21SharedMatrix::Snapshot::operator->() const {
+  return &version_->matrix;
+}
+
+unsigned long long S21SharedMatrix::Snapshot::GetVersion() const {
+  return version_->number;
+}
+
+S21SharedMatrix::Reader::Reader(S21SharedMatrix *owner, Slot *slot)
+    : owner_(owner), slot_(slot) {}
+
+S21SharedMatrix::Reader::Reader(Reader &&other) noexcept
+    : owner_(other.owner_), slot_(other.slot_) {
+  other.owner_ = nullptr;
+  other.slot_ = nullptr;
+}
+
+S21SharedMatrix::Reader::~Reader() {
+  if (!owner_) return;
+  std::lock_guard<std::mutex> lock(owner_->writer_mutex_);
+  owner_->slots_.remove_if([this](const Slot &slot) { return &slot == slot_; });
+}
+
+S21SharedMatrix::Snapshot S21SharedMatrix::Reader::Acquire() {
+  // Эпоха объявляется до чтения указателя: писатель, заменивший версию
+  // позже, увидит слот и не удалит ее
+  if (slot_->depth++ == 0) {
+    slot_->epoch.store(owner_->epoch_.load());
+  }
+  return Snapshot(this, owner_->current_.load());
+}
+
+void S21SharedMatrix::Reader::Release() {
+  if (--slot_->depth == 0) {
+    slot_->epoch.store(kIdle);
+  }
+}
+
+S21SharedMatrix::S21SharedMatrix(S21Matrix initial)
+    : current_(new Version{std::move(initial), 0}), version_(0), epoch_(0) {}
+
+S21SharedMatrix::~S21SharedMatrix() {
+  for (const Retired &retired : retired_) delete retired.version;
+  delete current_.load();
+}
+
+S21SharedMatrix::Reader S21SharedMatrix::RegisterReader() {
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  slots_.emplace_back();
+  return Reader(this, &slots_.back());
+}
+
+void S21SharedMatrix::Publish(S21Matrix matrix) {
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  PublishLocked(std::move(matrix));
+}
+
+unsigned long long S21SharedMatrix::GetVersion() const {
+  return version_.load();
+}
+
+size_t S21SharedMatrix::Reclaim() {
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  return ReclaimLocked();
+}
+
+void S21SharedMatrix::Synchronize() {
+  while (Reclaim() != 0) {
+    std::this_thread::yield();
+  }
+}
+
+void S21SharedMatrix::PublishLocked(S21Matrix matrix) {
+  unsigned long long number = version_.load() + 1;
+  Version *next = new Version{std::move(matrix), number};
+  Version *old = current_.exchange(next);
+  version_.store(number);
+  // Читатели, объявившие эпоху не больше retired.epoch, могли успеть взять
+  // old; начавшие позже увидят уже next
+  retired_.push_back({old, epoch_.fetch_add(1)});
+  ReclaimLocked();
+}
+
+size_t S21SharedMatrix::ReclaimLocked() {
+  uint64_t oldest = kIdle;
+  for (const Reader::Slot &slot : slots_) {
+    oldest = std::min(oldest, slot.epoch.load());
+  }
+  auto expired = std::partition(
+      retired_.begin(), retired_.end(),
+      [oldest](const Retired &retired) { return retired.epoch >= oldest; });
+  for (auto it = expired; it != retired_.end(); ++it) delete it->version;
+  retired_.erase(expired, retired_.end());
+  return retired_.size();
+}
@@ -0,0 +1,128 @@
+#ifndef S21_SHARED_MATRIX_H
+#define S21_SHARED_MATRIX_H
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Матрица для одного писателя и многих читателей в стиле RCU. Писатель
+// готовит новую версию целиком и публикует ее одной атомарной заменой
+// указателя. Читатель берет снимок без блокировок и ожидания и видит
+// неизменную версию, пока держит снимок. Старая версия удаляется, когда
+// завершились все снимки, взятые до ее замены (период отсрочки)
+class S21SharedMatrix {
+  struct Version;
+
+ public:
+  class Reader;
+
+  // Снимок одной версии; действителен, пока жив его Reader
+  class Snapshot {
+   public:
+    Snapshot(Snapshot &&other) noexcept;
+    Snapshot(const Snapshot &other) = delete;
+    ~Snapshot();
+    Snapshot &operator=(const Snapshot &other) = delete;
+    Snapshot &operator=(Snapshot &&other) = delete;
+
+    const S21Matrix &operator*() const;
+    const S21Matrix *operator->() const;
+    // Номер публикации, начиная с 0 для исходной матрицы
+    unsigned long long GetVersion() const;
+
+   private:
+    friend class Reader;
+    Snapshot(Reader *reader, const Version *version);
+
+    Reader *reader_;
+    const Version *version_;
+  };
+
+  // Место читателя. Каждый поток-читатель заводит свой Reader через
+  // RegisterReader; Acquire на нем не блокируется и не ждет писателя
+  class Reader {
+   public:
+    Reader(Reader &&other) noexcept;
+    Reader(const Reader &other) = delete;
+    ~Reader();
+    Reader &operator=(const Reader &other) = delete;
+    Reader &operator=(Reader &&other) = delete;
+
+    // Вложенные снимки одного Reader допустимы
+    Snapshot Acquire();
+
+   private:
+    friend class S21SharedMatrix;
+    friend class Snapshot;
+    struct Slot;
+
+    Reader(S21SharedMatrix *owner, Slot *slot);
+    void Release();
+
+    S21SharedMatrix *owner_;
+    Slot *slot_;
+  };
+
+  explicit S21SharedMatrix(S21Matrix initial);
+  S21SharedMatrix(const S21SharedMatrix &other) = delete;
+  // Все Reader должны быть уничтожены раньше
+  ~S21SharedMatrix();
+  S21SharedMatrix &operator=(const S21SharedMatrix &other) = delete;
+
+  Reader RegisterReader();
+
+  // Публикует matrix как новую версию и удаляет версии, которых уже никто
+  // не читает. Писатели упорядочиваются между собой мьютексом
+  void Publish(S21Matrix matrix);
+  // Копирует текущую версию, изменяет копию через update(S21Matrix &) и
+  // публикует ее
+  template <class Update>
+  void Modify(Update update);
+
+  unsigned long long GetVersion() const;
+  // Удаляет версии, пережившие период отсрочки; возвращает число
+  // ожидающих удаления
+  size_t Reclaim();
+  // Ждет завершения снимков, взятых до вызова, и удаляет все старые версии
+  void Synchronize();
+
+ private:
+  struct Version {
+    S21Matrix matrix;
+    unsigned long long number;
+  };
+  struct Retired {
+    Version *version;
+    uint64_t epoch;
+  };
+
+  std::atomic<Version *> current_;
+  std::atomic<unsigned long long> version_;
+  // Эпоха растет при каждой публикации; читатель объявляет в своем слоте
+  // эпоху, в которую начал снимок
+  std::atomic<uint64_t> epoch_;
+  std::mutex writer_mutex_;
+  std::list<Reader::Slot> slots_;
+  std::vector<Retired> retired_;
+
+  // Вызываются под writer_mutex_
+  void PublishLocked(S21Matrix matrix);
+  size_t ReclaimLocked();
+};
+
+template <class Update>
+void S21SharedMatrix::Modify(Update update) {
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  // Текущую версию может удалить только писатель, поэтому под мьютексом
+  // ее можно читать без снимка
+  S21Matrix copy(current_.load()->matrix);
+  update(copy);
+  PublishLocked(std::move(copy));
+}
+
+#endif
@@ -0,0 +1,218 @@
+#include "s21_shared_memory.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace {
+
+const uint32_t kMagic = 0x53323153;  // "S21S"
+const uint32_t kFormatVersion = 1;
+// Тип элементов; сейчас поддерживается только double
+const uint32_t kTypeDouble = 1;
+// Данные начинаются с границы кэш-линии
+const size_t kDataOffset = 64;
+
+}  // namespace
+
+struct S21ShmMatrix::Header {
+  uint32_t magic;
+  uint32_t format_version;
+  uint32_t element_type;
+  uint32_t element_size;
+  int32_t rows;
+  int32_t cols;
+  std::atomic<uint64_t> sequence;
+};
+
+S21ShmMatrix::S21ShmMatrix(const std::string &name, int rows, int cols)
+    : name_(name), mapping_(nullptr), size_(0) {
+  static_assert(sizeof(Header) <= kDataOffset, "Header must fit before data");
+  static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                "Sequence must be lock-free to be shared between processes");
+  if (rows < 1 || cols < 1) throw S21SizeError("Invalid matrix size");
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) throw S21SystemError("Cannot create shared memory segment");
+  size_t size = kDataOffset + sizeof(double) * rows * cols;
+  if (ftruncate(fd, size) != 0) {
+    close(fd);
+    shm_unlink(name.c_str());
+    throw S21SystemError("Cannot create shared memory segment");
+  }
+  try {
+    Map(fd, size);
+  } catch (...) {
+    shm_unlink(name.c_str());
+    throw;
+  }
+  // ftruncate заполнил сегмент нулями, остается заголовок
+  Header *header = new (mapping_) Header;
+  header->format_version = kFormatVersion;
+  header->element_type = kTypeDouble;
+  header->element_size = sizeof(double);
+  header->rows = rows;
+  header->cols = cols;
+  header->sequence.store(0, std::memory_order_relaxed);
+  // Подключившиеся процессы проверяют magic последним
+  std::atomic_thread_fence(std::memory_order_release);
+  header->magic = kMagic;
+}
+
+S21ShmMatrix::S21ShmMatrix(const std::string &name)
+    : name_(name), mapping_(nullptr), size_(0) {
+  int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd < 0) throw S21SystemError("Cannot open shared memory segment");
+  struct stat info;
+  if (fstat(fd, &info) != 0 || (size_t)info.st_size < kDataOffset) {
+    close(fd);
+    throw S21SystemError("Invalid shared memory segment");
+  }
+  Map(fd, info.st_size);
+  const Header *header = GetHeader();
+  bool valid = header->magic == kMagic &&
+               header->format_version == kFormatVersion &&
+               header->element_type == kTypeDouble &&
+               header->element_size == sizeof(double) && header->rows > 0 &&
+               header->cols > 0 &&
+               size_ >= kDataOffset + sizeof(double) * header->rows *
+                                          header->cols;
+  if (!valid) {
+    munmap(mapping_, size_);
+    mapping_ = nullptr;
+    throw S21SystemError("Invalid shared memory segment");
+  }
+}
+
+S21ShmMatrix::S21ShmMatrix(S21ShmMatrix &&other) noexcept
+    : name_(std::move(other.name_)),
+      mapping_(other.mapping_),
+      size_(other.size_) {
+  other.mapping_ = nullptr;
+  other.size_ = 0;
+}
+
+S21ShmMatrix::~S21ShmMatrix() {
+  if (mapping_) munmap(mapping_, size_);
+}
+
+S21ShmMatrix &S21ShmMatrix::operator=(S21ShmMatrix &&other) noexcept {
+  std::swap(name_, other.name_);
+  std::swap(mapping_, other.mapping_);
+  std::swap(size_, other.size_);
+  return *this;
+}
+
+void S21ShmMatrix::Unlink(const std::string &name) {
+  if (shm_unlink(name.c_str()) != 0) {
+    throw S21SystemError("Cannot unlink shared memory");
+  }
+}
+
+const std::string &S21ShmMatrix::GetName() const { return name_; }
+
+int S21ShmMatrix::GetRows() const { return GetHeader()->rows; }
+
+int S21ShmMatrix::GetCols() const { return GetHeader()->cols; }
+
+const double *S21ShmMatrix::GetData() const {
+  return reinterpret_cast<const double *>(static_cast<char *>(mapping_) +
+                                          kDataOffset);
+}
+
+S21Matrix S21ShmMatrix::View() {
+  return S21Matrix::View(const_cast<double *>(GetData()), GetRows(), GetCols(),
+                         GetCols());
+}
+
+unsigned long long S21ShmMatrix::GetSequence() const {
+  return GetHeader()->sequence.load(std::memory_order_acquire);
+}
+
+bool S21ShmMatrix::Validate(unsigned long long sequence) const {
+  // Чтения данных не должны переместиться за повторную загрузку номера
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return sequence % 2 == 0 &&
+         GetHeader()->sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+unsigned long long S21ShmMatrix::WaitForUpdate(unsigned long long sequence,
+                                               int timeout_ms) const {
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::milliseconds(timeout_ms);
+  auto pause = std::chrono::microseconds(1);
+  unsigned long long current = GetSequence();
+  while ((current <= sequence || current % 2) &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(pause);
+    pause = std::min(pause * 2, std::chrono::microseconds(1000));
+    current = GetSequence();
+  }
+  return current;
+}
+
+double *S21ShmMatrix::BeginWrite() {
+  std::atomic<uint64_t> &sequence = GetHeader()->sequence;
+  uint64_t current = sequence.load(std::memory_order_relaxed);
+  if (current % 2 ||
+      !sequence.compare_exchange_strong(current, current + 1,
+                                        std::memory_order_relaxed)) {
+    throw S21StateError("Write already in progress");
+  }
+  // Запись данных не должна обогнать нечетный номер
+  std::atomic_thread_fence(std::memory_order_release);
+  return const_cast<double *>(GetData());
+}
+
+unsigned long long S21ShmMatrix::EndWrite() {
+  std::atomic<uint64_t> &sequence = GetHeader()->sequence;
+  uint64_t current = sequence.load(std::memory_order_relaxed);
+  if (current % 2 == 0) throw S21StateError("No write in progress");
+  sequence.store(current + 1, std::memory_order_release);
+  return current + 1;
+}
+
+unsigned long long S21ShmMatrix::Publish(const S21Matrix &matrix) {
+  if (matrix.GetRows() != GetRows() || matrix.GetCols() != GetCols()) {
+    throw S21SizeError("Incorrect matrix size");
+  }
+  matrix.CopyTo(BeginWrite());
+  return EndWrite();
+}
+
+unsigned long long S21ShmMatrix::Read(S21Matrix &out) const {
+  if (out.GetRows() != GetRows() || out.GetCols() != GetCols()) {
+    out = S21Matrix(GetRows(), GetCols());
+  }
+  while (true) {
+    unsigned long long sequence = GetSequence();
+    if (sequence % 2 == 0) {
+      out.Assign(GetData());
+      if (Validate(sequence)) return sequence;
+    }
+    std::this_thread::yield();
+  }
+}
+
+S21ShmMatrix::Header *S21ShmMatrix::GetHeader() const {
+  return static_cast<Header *>(mapping_);
+}
+
+void S21ShmMatrix::Map(int fd, size_t size) {
+  void *mapping =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    throw S21SystemError("Cannot map shared memory segment");
+  }
+  mapping_ = mapping;
+  size_ = size;
+}
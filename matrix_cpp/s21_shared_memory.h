@@ -0,0 +1,76 @@
+#ifndef S21_SHARED_MEMORY_H
+#define S21_SHARED_MEMORY_H
+
+#include <string>
+
+#include "s21_matrix_oop.h"
+
+// Матрица в именованном сегменте разделяемой памяти POSIX. Сегмент
+// начинается с заголовка (формат, тип элементов, размер, номер публикации),
+// за ним построчно лежат элементы. Другой процесс подключается по имени и
+// работает с данными на месте, без копирования и сериализации: View дает
+// обычную S21Matrix поверх элементов сегмента.
+//
+// Публикация устроена как seqlock: номер нечетный, пока писатель меняет
+// данные, и четный между записями. Читатель запоминает четный номер, читает
+// и проверяет, что номер не изменился. Писатель в каждый момент один
+class S21ShmMatrix {
+ public:
+  // Создает сегмент name (вида "/имя") под матрицу rows x cols из нулей.
+  // Бросает исключение, если сегмент уже существует
+  S21ShmMatrix(const std::string &name, int rows, int cols);
+  // Подключается к сегменту, созданному другим объектом или процессом
+  explicit S21ShmMatrix(const std::string &name);
+  S21ShmMatrix(const S21ShmMatrix &other) = delete;
+  S21ShmMatrix(S21ShmMatrix &&other) noexcept;
+  // Отключается от сегмента; сам сегмент живет до Unlink
+  ~S21ShmMatrix();
+
+  S21ShmMatrix &operator=(const S21ShmMatrix &other) = delete;
+  S21ShmMatrix &operator=(S21ShmMatrix &&other) noexcept;
+
+  // Удаляет имя сегмента; подключенные объекты продолжают работать
+  static void Unlink(const std::string &name);
+
+  const std::string &GetName() const;
+  int GetRows() const;
+  int GetCols() const;
+  // Элементы в сегменте, строка i начинается с GetData() + i * GetCols()
+  const double *GetData() const;
+  // S21Matrix над элементами сегмента без копирования; не должна пережить
+  // этот объект. Писатель меняет ее между BeginWrite и EndWrite, читатель
+  // только читает и подтверждает снимок через Validate. Кэш представления
+  // не видит публикаций других процессов, поэтому на каждый снимок берется
+  // новое представление
+  S21Matrix View();
+
+  // Номер последней публикации; нечетный — идет запись
+  unsigned long long GetSequence() const;
+  // true, если с момента чтения номера sequence данные не менялись
+  bool Validate(unsigned long long sequence) const;
+  // Ждет публикации с номером больше sequence не дольше timeout_ms
+  // миллисекунд и возвращает текущий номер
+  unsigned long long WaitForUpdate(unsigned long long sequence,
+                                   int timeout_ms) const;
+
+  // Начинает запись и возвращает изменяемые данные сегмента
+  double *BeginWrite();
+  // Завершает запись и возвращает номер новой публикации
+  unsigned long long EndWrite();
+  // Копирует matrix того же размера в сегмент одной публикацией
+  unsigned long long Publish(const S21Matrix &matrix);
+  // Копирует согласованный снимок в out и возвращает его номер
+  unsigned long long Read(S21Matrix &out) const;
+
+ private:
+  struct Header;
+
+  std::string name_;
+  void *mapping_;
+  size_t size_;
+
+  Header *GetHeader() const;
+  void Map(int fd, size_t size);
+};
+
+#endif
@@ -0,0 +1,727 @@
+#include "s21_structured_matrix.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace {
+
+// Гауссово исключение с выбором главного элемента для плотной матрицы n x n,
+// хранящейся построчно. rhs (n x nrhs) заменяется решением. Возвращает
+// определитель, для вырожденной матрицы — 0
+double EliminateDense(std::vector<double> &a, int n, std::vector<double> &rhs,
+                      int nrhs) {
+  double determinant = 1;
+  for (int k = 0; k < n; k++) {
+    int pivot = k;
+    for (int i = k + 1; i < n; i++) {
+      if (fabs(a[i * n + k]) > fabs(a[pivot * n + k])) {
+        pivot = i;
+      }
+    }
+    if (a[pivot * n + k] == 0) {
+      return 0;
+    }
+    if (pivot != k) {
+      for (int j = 0; j < n; j++) std::swap(a[k * n + j], a[pivot * n + j]);
+      for (int j = 0; j < nrhs; j++)
+        std::swap(rhs[k * nrhs + j], rhs[pivot * nrhs + j]);
+      determinant = -determinant;
+    }
+    determinant *= a[k * n + k];
+    for (int i = k + 1; i < n; i++) {
+      double factor = a[i * n + k] / a[k * n + k];
+      for (int j = k; j < n; j++) a[i * n + j] -= factor * a[k * n + j];
+      for (int j = 0; j < nrhs; j++)
+        rhs[i * nrhs + j] -= factor * rhs[k * nrhs + j];
+    }
+  }
+  for (int i = n - 1; i >= 0; i--) {
+    for (int j = 0; j < nrhs; j++) {
+      double value = rhs[i * nrhs + j];
+      for (int k = i + 1; k < n; k++) value -= a[i * n + k] * rhs[k * nrhs + j];
+      rhs[i * nrhs + j] = value / a[i * n + i];
+    }
+  }
+  return determinant;
+}
+
+// Если out совпадает с плотным операндом, результат считается во временную
+// матрицу
+template <class Kernel>
+void MultiplyInto(S21Matrix &out, const S21Matrix &dense, Kernel kernel) {
+  if (&out == &dense) {
+    S21Matrix temp;
+    kernel(temp);
+    out = std::move(temp);
+  } else {
+    kernel(out);
+  }
+}
+
+}  // namespace
+
+// ---------------------------------------------------------------- diagonal
+
+S21DiagonalMatrix::S21DiagonalMatrix(int size) {
+  if (size <= 0) {
+    throw S21SizeError("Invalid matrix size");
+  }
+  size_ = size;
+  diagonal_.assign(size, 0);
+}
+
+int S21DiagonalMatrix::GetSize() const { return size_; }
+
+double S21DiagonalMatrix::GetMatrixMember(int row, int col) const {
+  if (row < 0 || row >= size_ || col < 0 || col >= size_) {
+    throw S21IndexError("Index out of range");
+  }
+  return row == col ? diagonal_[row] : 0;
+}
+
+void S21DiagonalMatrix::SetMatrixMember(int row, int col, double value) {
+  if (row < 0 || row >= size_ || col < 0 || col >= size_) {
+    throw S21IndexError("Index out of range");
+  }
+  if (row == col) {
+    diagonal_[row] = value;
+  } else if (value != 0) {
+    throw S21IndexError("Element outside of the structure");
+  }
+}
+
+double S21DiagonalMatrix::Determinant() const {
+  double result = 1;
+  for (int i = 0; i < size_; i++) result *= diagonal_[i];
+  return result;
+}
+
+S21DiagonalMatrix S21DiagonalMatrix::Transpose() const { return *this; }
+
+S21Matrix S21DiagonalMatrix::Solve(const S21Matrix &b) const {
+  if (b.rows_ != size_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  S21Matrix result(b.rows_, b.cols_);
+  for (int i = 0; i < size_; i++) {
+    if (diagonal_[i] == 0) {
+      throw S21SingularError("Null determinant");
+    }
+    for (int j = 0; j < b.cols_; j++) {
+      result.matrix_[i][j] = b.matrix_[i][j] / diagonal_[i];
+    }
+  }
+  return result;
+}
+
+S21Matrix S21DiagonalMatrix::ToDense() const {
+  S21Matrix result(size_, size_);
+  for (int i = 0; i < size_; i++) result.matrix_[i][i] = diagonal_[i];
+  return result;
+}
+
+void S21DiagonalMatrix::MultiplyLeft(S21Matrix &out,
+                                     const S21Matrix &b) const {
+  if (b.rows_ != size_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  out.Reallocate(b.rows_, b.cols_);
+  for (int i = 0; i < size_; i++) {
+    for (int j = 0; j < b.cols_; j++) {
+      out.matrix_[i][j] = diagonal_[i] * b.matrix_[i][j];
+    }
+  }
+}
+
+void S21DiagonalMatrix::MultiplyRight(S21Matrix &out,
+                                      const S21Matrix &a) const {
+  if (a.cols_ != size_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  out.Reallocate(a.rows_, a.cols_);
+  for (int i = 0; i < a.rows_; i++) {
+    for (int j = 0; j < size_; j++) {
+      out.matrix_[i][j] = a.matrix_[i][j] * diagonal_[j];
+    }
+  }
+}
+
+// -------------------------------------------------------------- triangular
+
+S21TriangularMatrix::S21TriangularMatrix(int size, bool upper) {
+  if (size <= 0) {
+    throw S21SizeError("Invalid matrix size");
+  }
+  size_ = size;
+  upper_ = upper;
+  packed_.assign(size * (size + 1) / 2, 0);
+}
+
+int S21TriangularMatrix::GetSize() const { return size_; }
+
+bool S21TriangularMatrix::IsUpper() const { return upper_; }
+
+bool S21TriangularMatrix::InTriangle(int row, int col) const {
+  return upper_ ? col >= row : col <= row;
+}
+
+int S21TriangularMatrix::Index(int row, int col) const {
+  return upper_ ? row * size_ - row * (row - 1) / 2 + col - row
+                : row * (row + 1) / 2 + col;
+}
+
+double S21TriangularMatrix::GetMatrixMember(int row, int col) const {
+  if (row < 0 || row >= size_ || col < 0 || col >= size_) {
+    throw S21IndexError("Index out of range");
+  }
+  return InTriangle(row, col) ? packed_[Index(row, col)] : 0;
+}
+
+void S21TriangularMatrix::SetMatrixMember(int row, int col, double value) {
+  if (row < 0 || row >= size_ || col < 0 || col >= size_) {
+    throw S21IndexError("Index out of range");
+  }
+  if (InTriangle(row, col)) {
+    packed_[Index(row, col)] = value;
+  } else if (value != 0) {
+    throw S21IndexError("Element outside of the structure");
+  }
+}
+
+double S21TriangularMatrix::Determinant() const {
+  double result = 1;
+  for (int i = 0; i < size_; i++) result *= packed_[Index(i, i)];
+  return result;
+}
+
+S21TriangularMatrix S21TriangularMatrix::Transpose() const {
+  S21TriangularMatrix result(size_, !upper_);
+  for (int i = 0; i < size_; i++) {
+    int begin = upper_ ? 0 : i;
+    int end = upper_ ? i + 1 : size_;
+    for (int j = begin; j < end; j++) {
+      result.packed_[result.Index(i, j)] = packed_[Index(j, i)];
+    }
+  }
+  return result;
+}
+
+S21Matrix S21TriangularMatrix::Solve(const S21Matrix &b) const {
+  if (b.rows_ != size_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  S21Matrix result(b);
+  for (int step = 0; step < size_; step++) {
+    int i = upper_ ? size_ - 1 - step : step;
+    double diagonal = packed_[Index(i, i)];
+    if (diagonal == 0) {
+      throw S21SingularError("Null determinant");
+    }
+    int begin = upper_ ? i + 1 : 0;
+    int end = upper_ ? size_ : i;
+    double *row = result.matrix_[i];
+    for (int k = begin; k < end; k++) {
+      double factor = packed_[Index(i, k)];
+      const double *solved = result.matrix_[k];
+      for (int j = 0; j < b.cols_; j++) row[j] -= factor * solved[j];
+    }
+    for (int j = 0; j < b.cols_; j++) row[j] /= diagonal;
+  }
+  return result;
+}
+
+S21Matrix S21TriangularMatrix::ToDense() const {
+  S21Matrix result(size_, size_);
+  for (int i = 0; i < size_; i++) {
+    for (int j = 0; j < size_; j++) {
+      if (InTriangle(i, j)) result.matrix_[i][j] = packed_[Index(i, j)];
+    }
+  }
+  return result;
+}
+
+void S21TriangularMatrix::MultiplyLeft(S21Matrix &out,
+                                       const S21Matrix &b) const {
+  if (b.rows_ != size_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  out.Reallocate(size_, b.cols_);
+  for (int i = 0; i < size_; i++) {
+    double *row = out.matrix_[i];
+    for (int j = 0; j < b.cols_; j++) row[j] = 0;
+    int begin = upper_ ? i : 0;
+    int end = upper_ ? size_ : i + 1;
+    // Элементы строки i лежат в packed_ подряд
+    const double *packed_row = &packed_[Index(i, begin)];
+    for (int k = begin; k < end; k++) {
+      double factor = packed_row[k - begin];
+      const double *b_row = b.matrix_[k];
+      for (int j = 0; j < b.cols_; j++) row[j] += factor * b_row[j];
+    }
+  }
+}
+
+void S21TriangularMatrix::MultiplyRight(S21Matrix &out,
+                                        const S21Matrix &a) const {
+  if (a.cols_ != size_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  out.Reallocate(a.rows_, size_);
+  for (int r = 0; r < a.rows_; r++) {
+    double *row = out.matrix_[r];
+    for (int j = 0; j < size_; j++) row[j] = 0;
+    for (int k = 0; k < size_; k++) {
+      double factor = a.matrix_[r][k];
+      int begin = upper_ ? k : 0;
+      int end = upper_ ? size_ : k + 1;
+      const double *packed_row = &packed_[Index(k, begin)];
+      for (int j = begin; j < end; j++) {
+        row[j] += factor * packed_row[j - begin];
+      }
+    }
+  }
+}
+
+// --------------------------------------------------------------- symmetric
+
+S21SymmetricMatrix::S21SymmetricMatrix(int size) {
+  if (size <= 0) {
+    throw S21SizeError("Invalid matrix size");
+  }
+  size_ = size;
+  packed_.assign(size * (size + 1) / 2, 0);
+}
+
+int S21SymmetricMatrix::GetSize() const { return size_; }
+
+int S21SymmetricMatrix::Index(int row, int col) const {
+  if (col > row) {
+    std::swap(row, col);
+  }
+  return row * (row + 1) / 2 + col;
+}
+
+double S21SymmetricMatrix::GetMatrixMember(int row, int col) const {
+  if (row < 0 || row >= size_ || col < 0 || col >= size_) {
+    throw S21IndexError("Index out of range");
+  }
+  return packed_[Index(row, col)];
+}
+
+void S21SymmetricMatrix::SetMatrixMember(int row, int col, double value) {
+  if (row < 0 || row >= size_ || col < 0 || col >= size_) {
+    throw S21IndexError("Index out of range");
+  }
+  packed_[Index(row, col)] = value;
+}
+
+bool S21SymmetricMatrix::Cholesky(std::vector<double> &factor) const {
+  factor.assign(packed_.size(), 0);
+  for (int i = 0; i < size_; i++) {
+    for (int j = 0; j <= i; j++) {
+      double value = packed_[Index(i, j)];
+      for (int k = 0; k < j; k++) {
+        value -= factor[Index(i, k)] * factor[Index(j, k)];
+      }
+      if (i == j) {
+        if (value <= 0) {
+          return false;
+        }
+        factor[Index(i, i)] = sqrt(value);
+      } else {
+        factor[Index(i, j)] = value / factor[Index(j, j)];
+      }
+    }
+  }
+  return true;
+}
+
+double S21SymmetricMatrix::Determinant() const {
+  std::vector<double> factor;
+  if (Cholesky(factor)) {
+    double result = 1;
+    for (int i = 0; i < size_; i++) result *= factor[Index(i, i)];
+    return result * result;
+  }
+  std::vector<double> dense(size_ * size_);
+  for (int i = 0; i < size_; i++)
+    for (int j = 0; j < size_; j++) dense[i * size_ + j] = packed_[Index(i, j)];
+  std::vector<double> rhs;
+  return EliminateDense(dense, size_, rhs, 0);
+}
+
+S21SymmetricMatrix S21SymmetricMatrix::Transpose() const { return *this; }
+
+S21Matrix S21SymmetricMatrix::Solve(const S21Matrix &b) const {
+  if (b.rows_ != size_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  S21Matrix result(b);
+  std::vector<double> factor;
+  if (Cholesky(factor)) {
+    // L * y = b, затем L^T * x = y
+    for (int i = 0; i < size_; i++) {
+      double *row = result.matrix_[i];
+      for (int k = 0; k < i; k++) {
+        double value = factor[Index(i, k)];
+        const double *solved = result.matrix_[k];
+        for (int j = 0; j < b.cols_; j++) row[j] -= value * solved[j];
+      }
+      for (int j = 0; j < b.cols_; j++) row[j] /= factor[Index(i, i)];
+    }
+    for (int i = size_ - 1; i >= 0; i--) {
+      double *row = result.matrix_[i];
+      for (int k = i + 1; k < size_; k++) {
+        double value = factor[Index(k, i)];
+        const double *solved = result.matrix_[k];
+        for (int j = 0; j < b.cols_; j++) row[j] -= value * solved[j];
+      }
+      for (int j = 0; j < b.cols_; j++) row[j] /= factor[Index(i, i)];
+    }
+    return result;
+  }
+  std::vector<double> dense(size_ * size_);
+  for (int i = 0; i < size_; i++)
+    for (int j = 0; j < size_; j++) dense[i * size_ + j] = packed_[Index(i, j)];
+  std::vector<double> rhs(size_ * b.cols_);
+  for (int i = 0; i < size_; i++)
+    for (int j = 0; j < b.cols_; j++) rhs[i * b.cols_ + j] = b.matrix_[i][j];
+  if (EliminateDense(dense, size_, rhs, b.cols_) == 0) {
+    throw S21SingularError("Null determinant");
+  }
+  for (int i = 0; i < size_; i++)
+    for (int j = 0; j < b.cols_; j++)
+      result.matrix_[i][j] = rhs[i * b.cols_ + j];
+  return result;
+}
+
+S21Matrix S21SymmetricMatrix::ToDense() const {
+  S21Matrix result(size_, size_);
+  for (int i = 0; i < size_; i++) {
+    for (int j = 0; j <= i; j++) {
+      result.matrix_[i][j] = packed_[Index(i, j)];
+      result.matrix_[j][i] = packed_[Index(i, j)];
+    }
+  }
+  return result;
+}
+
+void S21SymmetricMatrix::MultiplyLeft(S21Matrix &out,
+                                      const S21Matrix &b) const {
+  if (b.rows_ != size_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  out.Reallocate(size_, b.cols_);
+  for (int i = 0; i < size_; i++)
+    for (int j = 0; j < b.cols_; j++) out.matrix_[i][j] = 0;
+  // Каждый хранимый элемент читается один раз и работает за два
+  const double *packed = packed_.data();
+  for (int i = 0; i < size_; i++) {
+    double *out_i = out.matrix_[i];
+    const double *b_i = b.matrix_[i];
+    for (int k = 0; k <= i; k++) {
+      double value = *packed++;
+      const double *b_k = b.matrix_[k];
+      for (int j = 0; j < b.cols_; j++) out_i[j] += value * b_k[j];
+      if (k != i) {
+        double *out_k = out.matrix_[k];
+        for (int j = 0; j < b.cols_; j++) out_k[j] += value * b_i[j];
+      }
+    }
+  }
+}
+
+void S21SymmetricMatrix::MultiplyRight(S21Matrix &out,
+                                       const S21Matrix &a) const {
+  if (a.cols_ != size_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  out.Reallocate(a.rows_, size_);
+  for (int r = 0; r < a.rows_; r++) {
+    double *row = out.matrix_[r];
+    const double *a_row = a.matrix_[r];
+    for (int j = 0; j < size_; j++) row[j] = 0;
+    const double *packed = packed_.data();
+    for (int i = 0; i < size_; i++) {
+      for (int k = 0; k < i; k++) {
+        double value = *packed++;
+        row[k] += a_row[i] * value;
+        row[i] += a_row[k] * value;
+      }
+      row[i] += a_row[i] * *packed++;
+    }
+  }
+}
+
+// ------------------------------------------------------------------ banded
+
+S21BandedMatrix::S21BandedMatrix(int size, int lower, int upper) {
+  if (size <= 0 || lower < 0 || upper < 0 || lower >= size ||
+      upper >= size) {
+    throw S21SizeError("Invalid matrix size");
+  }
+  size_ = size;
+  lower_ = lower;
+  upper_ = upper;
+  band_.assign(size * (lower + upper + 1), 0);
+}
+
+int S21BandedMatrix::GetSize() const { return size_; }
+
+int S21BandedMatrix::GetLower() const { return lower_; }
+
+int S21BandedMatrix::GetUpper() const { return upper_; }
+
+bool S21BandedMatrix::InBand(int row, int col) const {
+  return col - row <= upper_ && row - col <= lower_;
+}
+
+int S21BandedMatrix::Index(int row, int col) const {
+  return row * (lower_ + upper_ + 1) + col - row + lower_;
+}
+
+double S21BandedMatrix::GetMatrixMember(int row, int col) const {
+  if (row < 0 || row >= size_ || col < 0 || col >= size_) {
+    throw S21IndexError("Index out of range");
+  }
+  return InBand(row, col) ? band_[Index(row, col)] : 0;
+}
+
+void S21BandedMatrix::SetMatrixMember(int row, int col, double value) {
+  if (row < 0 || row >= size_ || col < 0 || col >= size_) {
+    throw S21IndexError("Index out of range");
+  }
+  if (InBand(row, col)) {
+    band_[Index(row, col)] = value;
+  } else if (value != 0) {
+    throw S21IndexError("Element outside of the structure");
+  }
+}
+
+double S21BandedMatrix::Factorize(std::vector<double> &work,
+                                  S21Matrix *rhs) const {
+  // Перестановки строк расширяют верхнюю ленту на lower_ диагоналей, поэтому
+  // строка i рабочей ленты хранит столбцы от i - lower_ до i + upper_ + lower_
+  int width = 2 * lower_ + upper_ + 1;
+  work.assign(size_ * width, 0);
+  for (int i = 0; i < size_; i++) {
+    for (int j = i - lower_; j <= i + upper_; j++) {
+      if (j >= 0 && j < size_) {
+        work[i * width + j - i + lower_] = band_[Index(i, j)];
+      }
+    }
+  }
+  double determinant = 1;
+  for (int k = 0; k < size_; k++) {
+    int last_row = std::min(size_ - 1, k + lower_);
+    int last_col = std::min(size_ - 1, k + lower_ + upper_);
+    int pivot = k;
+    for (int i = k + 1; i <= last_row; i++) {
+      if (fabs(work[i * width + k - i + lower_]) >
+          fabs(work[pivot * width + k - pivot + lower_])) {
+        pivot = i;
+      }
+    }
+    double pivot_value = work[pivot * width + k - pivot + lower_];
+    if (pivot_value == 0) {
+      return 0;
+    }
+    if (pivot != k) {
+      for (int j = k; j <= last_col; j++) {
+        std::swap(work[k * width + j - k + lower_],
+                  work[pivot * width + j - pivot + lower_]);
+      }
+      if (rhs != nullptr) {
+        std::swap_ranges(rhs->matrix_[k], rhs->matrix_[k] + rhs->cols_,
+                         rhs->matrix_[pivot]);
+      }
+      determinant = -determinant;
+    }
+    determinant *= pivot_value;
+    for (int i = k + 1; i <= last_row; i++) {
+      double factor = work[i * width + k - i + lower_] / pivot_value;
+      if (factor == 0) continue;
+      for (int j = k; j <= last_col; j++) {
+        work[i * width + j - i + lower_] -=
+            factor * work[k * width + j - k + lower_];
+      }
+      if (rhs != nullptr) {
+        for (int j = 0; j < rhs->cols_; j++) {
+          rhs->matrix_[i][j] -= factor * rhs->matrix_[k][j];
+        }
+      }
+    }
+  }
+  return determinant;
+}
+
+double S21BandedMatrix::Determinant() const {
+  std::vector<double> work;
+  return Factorize(work, nullptr);
+}
+
+S21BandedMatrix S21BandedMatrix::Transpose() const {
+  S21BandedMatrix result(size_, upper_, lower_);
+  for (int i = 0; i < size_; i++) {
+    for (int j = i - lower_; j <= i + upper_; j++) {
+      if (j >= 0 && j < size_) {
+        result.band_[result.Index(j, i)] = band_[Index(i, j)];
+      }
+    }
+  }
+  return result;
+}
+
+S21Matrix S21BandedMatrix::Solve(const S21Matrix &b) const {
+  if (b.rows_ != size_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  S21Matrix result(b);
+  std::vector<double> work;
+  if (Factorize(work, &result) == 0) {
+    throw S21SingularError("Null determinant");
+  }
+  int width = 2 * lower_ + upper_ + 1;
+  for (int i = size_ - 1; i >= 0; i--) {
+    double *row = result.matrix_[i];
+    int last_col = std::min(size_ - 1, i + lower_ + upper_);
+    for (int k = i + 1; k <= last_col; k++) {
+      double factor = work[i * width + k - i + lower_];
+      for (int j = 0; j < b.cols_; j++) row[j] -= factor * result.matrix_[k][j];
+    }
+    for (int j = 0; j < b.cols_; j++) row[j] /= work[i * width + lower_];
+  }
+  return result;
+}
+
+S21Matrix S21BandedMatrix::ToDense() const {
+  S21Matrix result(size_, size_);
+  for (int i = 0; i < size_; i++) {
+    for (int j = std::max(0, i - lower_); j <= std::min(size_ - 1, i + upper_);
+         j++) {
+      result.matrix_[i][j] = band_[Index(i, j)];
+    }
+  }
+  return result;
+}
+
+void S21BandedMatrix::MultiplyLeft(S21Matrix &out, const S21Matrix &b) const {
+  if (b.rows_ != size_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  out.Reallocate(size_, b.cols_);
+  for (int i = 0; i < size_; i++) {
+    double *row = out.matrix_[i];
+    for (int j = 0; j < b.cols_; j++) row[j] = 0;
+    for (int k = std::max(0, i - lower_); k <= std::min(size_ - 1, i + upper_);
+         k++) {
+      double factor = band_[Index(i, k)];
+      const double *b_row = b.matrix_[k];
+      for (int j = 0; j < b.cols_; j++) row[j] += factor * b_row[j];
+    }
+  }
+}
+
+void S21BandedMatrix::MultiplyRight(S21Matrix &out,
+                                    const S21Matrix &a) const {
+  if (a.cols_ != size_) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  out.Reallocate(a.rows_, size_);
+  for (int r = 0; r < a.rows_; r++) {
+    double *row = out.matrix_[r];
+    for (int j = 0; j < size_; j++) row[j] = 0;
+    for (int k = 0; k < size_; k++) {
+      double factor = a.matrix_[r][k];
+      for (int j = std::max(0, k - lower_);
+           j <= std::min(size_ - 1, k + upper_); j++) {
+        row[j] += factor * band_[Index(k, j)];
+      }
+    }
+  }
+}
+
+// ------------------------------------------------------- mixed products
+
+void Multiply(S21Matrix &out, const S21DiagonalMatrix &a, const S21Matrix &b) {
+  MultiplyInto(out, b, [&](S21Matrix &dst) { a.MultiplyLeft(dst, b); });
+}
+
+void Multiply(S21Matrix &out, const S21Matrix &a, const S21DiagonalMatrix &b) {
+  MultiplyInto(out, a, [&](S21Matrix &dst) { b.MultiplyRight(dst, a); });
+}
+
+void Multiply(S21Matrix &out, const S21TriangularMatrix &a,
+              const S21Matrix &b) {
+  MultiplyInto(out, b, [&](S21Matrix &dst) { a.MultiplyLeft(dst, b); });
+}
+
+void Multiply(S21Matrix &out, const S21Matrix &a,
+              const S21TriangularMatrix &b) {
+  MultiplyInto(out, a, [&](S21Matrix &dst) { b.MultiplyRight(dst, a); });
+}
+
+void Multiply(S21Matrix &out, const S21SymmetricMatrix &a, const S21Matrix &b) {
+  MultiplyInto(out, b, [&](S21Matrix &dst) { a.MultiplyLeft(dst, b); });
+}
+
+void Multiply(S21Matrix &out, const S21Matrix &a, const S21SymmetricMatrix &b) {
+  MultiplyInto(out, a, [&](S21Matrix &dst) { b.MultiplyRight(dst, a); });
+}
+
+void Multiply(S21Matrix &out, const S21BandedMatrix &a, const S21Matrix &b) {
+  MultiplyInto(out, b, [&](S21Matrix &dst) { a.MultiplyLeft(dst, b); });
+}
+
+void Multiply(S21Matrix &out, const S21Matrix &a, const S21BandedMatrix &b) {
+  MultiplyInto(out, a, [&](S21Matrix &dst) { b.MultiplyRight(dst, a); });
+}
+
+S21Matrix operator*(const S21DiagonalMatrix &a, const S21Matrix &b) {
+  S21Matrix result;
+  Multiply(result, a, b);
+  return result;
+}
+
+S21Matrix operator*(const S21Matrix &a, const S21DiagonalMatrix &b) {
+  S21Matrix result;
+  Multiply(result, a, b);
+  return result;
+}
+
+S21Matrix operator*(const S21TriangularMatrix &a, const S21Matrix &b) {
+  S21Matrix result;
+  Multiply(result, a, b);
+  return result;
+}
+
+S21Matrix operator*(const S21Matrix &a, const S21TriangularMatrix &b) {
+  S21Matrix result;
+  Multiply(result, a, b);
+  return result;
+}
+
+S21Matrix operator*(const S21SymmetricMatrix &a, const S21Matrix &b) {
+  S21Matrix result;
+  Multiply(result, a, b);
+  return result;
+}
+
+S21Matrix operator*(const S21Matrix &a, const S21SymmetricMatrix &b) {
+  S21Matrix result;
+  Multiply(result, a, b);
+  return result;
+}
+
+S21Matrix operator*(const S21BandedMatrix &a, const S21Matrix &b) {
+  S21Matrix result;
+  Multiply(result, a, b);
+  return result;
+}
+
+S21Matrix operator*(const S21Matrix &a, const S21BandedMatrix &b) {
+  S21Matrix result;
+  Multiply(result, a, b);
+  return result;
+}
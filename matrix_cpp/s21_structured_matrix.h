@@ -0,0 +1,164 @@
+#ifndef S21_STRUCTURED_MATRIX_H
+#define S21_STRUCTURED_MATRIX_H
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Квадратные матрицы специального вида. Хранятся только значимые элементы, а
+// умножение на плотную S21Matrix, решение систем, определитель и
+// транспонирование учитывают структуру. Смешанные произведения с S21Matrix
+// выбираются перегрузками Multiply и operator*
+
+// Диагональная матрица
+class S21DiagonalMatrix {
+ public:
+  explicit S21DiagonalMatrix(int size);
+
+  int GetSize() const;
+  double GetMatrixMember(int row, int col) const;
+  // Внедиагональные элементы можно задать только нулем
+  void SetMatrixMember(int row, int col, double value);
+
+  double Determinant() const;
+  S21DiagonalMatrix Transpose() const;
+  // Возвращает x, для которого this * x = b
+  S21Matrix Solve(const S21Matrix &b) const;
+  S21Matrix ToDense() const;
+
+  friend void Multiply(S21Matrix &out, const S21DiagonalMatrix &a,
+                       const S21Matrix &b);
+  friend void Multiply(S21Matrix &out, const S21Matrix &a,
+                       const S21DiagonalMatrix &b);
+
+ private:
+  int size_;
+  std::vector<double> diagonal_;
+
+  void MultiplyLeft(S21Matrix &out, const S21Matrix &b) const;
+  void MultiplyRight(S21Matrix &out, const S21Matrix &a) const;
+};
+
+// Верхне- или нижнетреугольная матрица в упакованном построчном хранении
+class S21TriangularMatrix {
+ public:
+  S21TriangularMatrix(int size, bool upper);
+
+  int GetSize() const;
+  bool IsUpper() const;
+  double GetMatrixMember(int row, int col) const;
+  // Элементы вне треугольника можно задать только нулем
+  void SetMatrixMember(int row, int col, double value);
+
+  double Determinant() const;
+  // Транспонированная верхнетреугольная матрица становится нижней и наоборот
+  S21TriangularMatrix Transpose() const;
+  // Прямая или обратная подстановка: возвращает x, для которого this * x = b
+  S21Matrix Solve(const S21Matrix &b) const;
+  S21Matrix ToDense() const;
+
+  friend void Multiply(S21Matrix &out, const S21TriangularMatrix &a,
+                       const S21Matrix &b);
+  friend void Multiply(S21Matrix &out, const S21Matrix &a,
+                       const S21TriangularMatrix &b);
+
+ private:
+  int size_;
+  bool upper_;
+  std::vector<double> packed_;
+
+  bool InTriangle(int row, int col) const;
+  int Index(int row, int col) const;
+  void MultiplyLeft(S21Matrix &out, const S21Matrix &b) const;
+  void MultiplyRight(S21Matrix &out, const S21Matrix &a) const;
+};
+
+// Симметричная матрица: хранится только нижний треугольник
+class S21SymmetricMatrix {
+ public:
+  explicit S21SymmetricMatrix(int size);
+
+  int GetSize() const;
+  double GetMatrixMember(int row, int col) const;
+  // Задает сразу оба элемента (row, col) и (col, row)
+  void SetMatrixMember(int row, int col, double value);
+
+  // Через разложение Холецкого, для незнакоопределенных матриц — методом Гаусса
+  double Determinant() const;
+  S21SymmetricMatrix Transpose() const;
+  S21Matrix Solve(const S21Matrix &b) const;
+  S21Matrix ToDense() const;
+
+  friend void Multiply(S21Matrix &out, const S21SymmetricMatrix &a,
+                       const S21Matrix &b);
+  friend void Multiply(S21Matrix &out, const S21Matrix &a,
+                       const S21SymmetricMatrix &b);
+
+ private:
+  int size_;
+  std::vector<double> packed_;
+
+  int Index(int row, int col) const;
+  // Разложение Холецкого L * L^T в упакованном виде, false если не удалось
+  bool Cholesky(std::vector<double> &factor) const;
+  void MultiplyLeft(S21Matrix &out, const S21Matrix &b) const;
+  void MultiplyRight(S21Matrix &out, const S21Matrix &a) const;
+};
+
+// Ленточная матрица с lower поддиагоналями и upper наддиагоналями
+class S21BandedMatrix {
+ public:
+  S21BandedMatrix(int size, int lower, int upper);
+
+  int GetSize() const;
+  int GetLower() const;
+  int GetUpper() const;
+  double GetMatrixMember(int row, int col) const;
+  // Элементы вне ленты можно задать только нулем
+  void SetMatrixMember(int row, int col, double value);
+
+  // LU-разложение с выбором главного элемента внутри ленты
+  double Determinant() const;
+  S21BandedMatrix Transpose() const;
+  S21Matrix Solve(const S21Matrix &b) const;
+  S21Matrix ToDense() const;
+
+  friend void Multiply(S21Matrix &out, const S21BandedMatrix &a,
+                       const S21Matrix &b);
+  friend void Multiply(S21Matrix &out, const S21Matrix &a,
+                       const S21BandedMatrix &b);
+
+ private:
+  int size_, lower_, upper_;
+  std::vector<double> band_;
+
+  bool InBand(int row, int col) const;
+  int Index(int row, int col) const;
+  // Приводит ленту к верхнетреугольному виду, преобразуя rhs; возвращает
+  // определитель
+  double Factorize(std::vector<double> &work, S21Matrix *rhs) const;
+  void MultiplyLeft(S21Matrix &out, const S21Matrix &b) const;
+  void MultiplyRight(S21Matrix &out, const S21Matrix &a) const;
+};
+
+void Multiply(S21Matrix &out, const S21DiagonalMatrix &a, const S21Matrix &b);
+void Multiply(S21Matrix &out, const S21Matrix &a, const S21DiagonalMatrix &b);
+void Multiply(S21Matrix &out, const S21TriangularMatrix &a,
+              const S21Matrix &b);
+void Multiply(S21Matrix &out, const S21Matrix &a,
+              const S21TriangularMatrix &b);
+void Multiply(S21Matrix &out, const S21SymmetricMatrix &a, const S21Matrix &b);
+void Multiply(S21Matrix &out, const S21Matrix &a, const S21SymmetricMatrix &b);
+void Multiply(S21Matrix &out, const S21BandedMatrix &a, const S21Matrix &b);
+void Multiply(S21Matrix &out, const S21Matrix &a, const S21BandedMatrix &b);
+
+S21Matrix operator*(const S21DiagonalMatrix &a, const S21Matrix &b);
+S21Matrix operator*(const S21Matrix &a, const S21DiagonalMatrix &b);
+S21Matrix operator*(const S21TriangularMatrix &a, const S21Matrix &b);
+S21Matrix operator*(const S21Matrix &a, const S21TriangularMatrix &b);
+S21Matrix operator*(const S21SymmetricMatrix &a, const S21Matrix &b);
+S21Matrix operator*(const S21Matrix &a, const S21SymmetricMatrix &b);
+S21Matrix operator*(const S21BandedMatrix &a, const S21Matrix &b);
+S21Matrix operator*(const S21Matrix &a, const S21BandedMatrix &b);
+
+#endif
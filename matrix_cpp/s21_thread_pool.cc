@@ -0,0 +1,143 @@
+#include "s21_thread_pool.h"
+
+#include <pthread.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <new>
+
+#include "s21_matrix_error.h"
+
+S21ThreadPool::S21ThreadPool(int threads) {
+  if (threads <= 0) {
+    throw S21ArgumentError("Invalid thread count");
+  }
+  threads_ = threads;
+  stop_ = false;
+  std::lock_guard<std::mutex> lock(mutex_);
+  StartWorkers();
+}
+
+S21ThreadPool::~S21ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  ready_.notify_all();
+  for (std::thread &worker : workers_) {
+    worker.join();
+  }
+}
+
+S21ThreadPool &S21ThreadPool::Instance() {
+  static S21ThreadPool pool(
+      std::max(1, (int)std::thread::hardware_concurrency()));
+  static int registered = pthread_atfork(&S21ThreadPool::PrepareFork,
+                                         &S21ThreadPool::ParentAfterFork,
+                                         &S21ThreadPool::ChildAfterFork);
+  (void)registered;
+  return pool;
+}
+
+int S21ThreadPool::GetThreadCount() { return threads_; }
+
+void S21ThreadPool::Submit(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (workers_.empty()) {
+      StartWorkers();
+    }
+    tasks_.push_back(std::move(task));
+  }
+  ready_.notify_one();
+}
+
+void S21ThreadPool::ParallelFor(int begin, int end, int grain,
+                                const std::function<void(int, int)> &body) {
+  if (begin >= end) {
+    return;
+  }
+  grain = std::max(1, grain);
+  int length = end - begin;
+  int chunks = std::min((length + grain - 1) / grain, GetThreadCount() + 1);
+  if (chunks <= 1) {
+    body(begin, end);
+    return;
+  }
+  struct State {
+    std::atomic<int> next{0};
+    int done = 0;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+  auto state = std::make_shared<State>();
+  auto run = [state, &body, begin, length, chunks]() {
+    for (int chunk = state->next++; chunk < chunks; chunk = state->next++) {
+      std::exception_ptr error;
+      try {
+        body(begin + (long long)length * chunk / chunks,
+             begin + (long long)length * (chunk + 1) / chunks);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (error && !state->error) {
+        state->error = error;
+      }
+      if (++state->done == chunks) {
+        state->finished.notify_all();
+      }
+    }
+  };
+  for (int i = 1; i < chunks; i++) {
+    Submit(run);
+  }
+  run();
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->finished.wait(lock, [&] { return state->done == chunks; });
+  if (state->error) {
+    std::rethrow_exception(state->error);
+  }
+}
+
+void S21ThreadPool::WorkerLoop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      ready_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+      if (stop_ && tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+
+void S21ThreadPool::StartWorkers() {
+  for (int i = 0; i < threads_; i++) {
+    workers_.emplace_back(&S21ThreadPool::WorkerLoop, this);
+  }
+}
+
+// Мьютекс держится на время fork, чтобы очередь не осталась в дочернем
+// процессе наполовину измененной
+void S21ThreadPool::PrepareFork() { Instance().mutex_.lock(); }
+
+void S21ThreadPool::ParentAfterFork() { Instance().mutex_.unlock(); }
+
+// В дочернем процессе есть только поток, вызвавший fork. Объекты потоков,
+// задачи и примитивы синхронизации родителя не уничтожаются, а бросаются:
+// их деструкторы ждали бы потоков, которых здесь нет
+void S21ThreadPool::ChildAfterFork() {
+  S21ThreadPool &pool = Instance();
+  new (&pool.workers_) std::vector<std::thread>();
+  new (&pool.tasks_) std::deque<std::function<void()>>();
+  new (&pool.mutex_) std::mutex();
+  new (&pool.ready_) std::condition_variable();
+}
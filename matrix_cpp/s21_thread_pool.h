@@ -0,0 +1,49 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Общий пул потоков библиотеки. Вычислительные ядра делят через него работу
+// между ядрами процессора
+class S21ThreadPool {
+ public:
+  explicit S21ThreadPool(int threads);
+  ~S21ThreadPool();
+
+  // Пул по умолчанию: по одному потоку на ядро. Пул переживает fork: в
+  // дочернем процессе очередь родителя отбрасывается, а потоки запускаются
+  // заново при первой задаче
+  static S21ThreadPool &Instance();
+
+  int GetThreadCount();
+  // Ставит задачу в очередь
+  void Submit(std::function<void()> task);
+  // Делит [begin, end) на куски не короче grain и вызывает body(from, to) для
+  // каждого. Вызывающий поток тоже берет куски, поэтому вложенные вызовы из
+  // задач пула не блокируются. Исключение из body пробрасывается вызывающему
+  void ParallelFor(int begin, int end, int grain,
+                   const std::function<void(int, int)> &body);
+
+ private:
+  int threads_;
+  std::vector<std::thread> workers_;
+  std::deque<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  bool stop_;
+
+  void WorkerLoop();
+  // Запускает threads_ потоков; вызывается под mutex_
+  void StartWorkers();
+  // Обработчики pthread_atfork для пула по умолчанию
+  static void PrepareFork();
+  static void ParentAfterFork();
+  static void ChildAfterFork();
+};
+
+#endif
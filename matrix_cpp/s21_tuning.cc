@@ -0,0 +1,264 @@
+#include "s21_tuning.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_matrix_reduce.h"
+#include "s21_vector.h"
+
+namespace {
+
+// S21GetTuning вызывается каждым ядром, поэтому чтение идет без блокировки:
+// каждое поле лежит в своей атомарной переменной. Читатель может застать
+// поля из двух соседних S21SetTuning, но каждое поле само по себе корректно.
+// Мьютекс упорядочивает только писателей
+std::mutex tuning_mutex;
+
+struct SharedParameters {
+  std::atomic<int> parallel_elements{S21TuningParameters().parallel_elements};
+  std::atomic<int> reduce_block_elements{
+      S21TuningParameters().reduce_block_elements};
+  std::atomic<long long> blocked_multiply_min{
+      S21TuningParameters().blocked_multiply_min};
+  std::atomic<int> multiply_tile{S21TuningParameters().multiply_tile};
+
+  S21TuningParameters Load() const {
+    S21TuningParameters result;
+    result.parallel_elements =
+        parallel_elements.load(std::memory_order_relaxed);
+    result.reduce_block_elements =
+        reduce_block_elements.load(std::memory_order_relaxed);
+    result.blocked_multiply_min =
+        blocked_multiply_min.load(std::memory_order_relaxed);
+    result.multiply_tile = multiply_tile.load(std::memory_order_relaxed);
+    return result;
+  }
+  void Store(const S21TuningParameters &parameters) {
+    parallel_elements.store(parameters.parallel_elements,
+                            std::memory_order_relaxed);
+    reduce_block_elements.store(parameters.reduce_block_elements,
+                                std::memory_order_relaxed);
+    blocked_multiply_min.store(parameters.blocked_multiply_min,
+                               std::memory_order_relaxed);
+    multiply_tile.store(parameters.multiply_tile, std::memory_order_relaxed);
+  }
+};
+
+SharedParameters &Current() {
+  static SharedParameters parameters;
+  return parameters;
+}
+
+bool IsValid(const S21TuningParameters &parameters) {
+  return parameters.parallel_elements > 0 &&
+         parameters.reduce_block_elements > 0 &&
+         parameters.blocked_multiply_min >= 0 &&
+         parameters.multiply_tile > 0;
+}
+
+// Применяет файл параметров поверх текущих значений
+bool ApplyTuningFile(const std::string &path) {
+  std::ifstream file(path);
+  if (!file) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(tuning_mutex);
+  S21TuningParameters parameters = Current().Load();
+  std::string line;
+  while (std::getline(file, line)) {
+    line = line.substr(0, line.find('#'));
+    size_t equals = line.find('=');
+    if (equals == std::string::npos) {
+      continue;
+    }
+    std::string key;
+    std::istringstream(line.substr(0, equals)) >> key;
+    std::istringstream stream(line.substr(equals + 1));
+    long long value;
+    if (!(stream >> value) || value < 0) {
+      continue;
+    }
+    if (key == "blocked_multiply_min") {
+      parameters.blocked_multiply_min = value;
+      continue;
+    }
+    if (value == 0 || value > std::numeric_limits<int>::max()) {
+      continue;
+    }
+    if (key == "parallel_elements") {
+      parameters.parallel_elements = static_cast<int>(value);
+    } else if (key == "reduce_block_elements") {
+      parameters.reduce_block_elements = static_cast<int>(value);
+    } else if (key == "multiply_tile") {
+      parameters.multiply_tile = static_cast<int>(value);
+    }
+  }
+  Current().Store(parameters);
+  return true;
+}
+
+void LoadFromEnvironment() {
+  static std::once_flag loaded;
+  std::call_once(loaded, [] {
+    const char *path = getenv("S21_MATRIX_TUNING");
+    if (path) {
+      ApplyTuningFile(path);
+    }
+  });
+}
+
+// Лучшее время из repetitions запусков, в секундах
+double Measure(const std::function<void()> &run, int repetitions) {
+  double best = std::numeric_limits<double>::max();
+  for (int i = 0; i < repetitions; i++) {
+    auto start = std::chrono::steady_clock::now();
+    run();
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    best = std::min(best, elapsed.count());
+  }
+  return best;
+}
+
+// Перебирает candidates, выставляя каждый через apply, и оставляет самый
+// быстрый вариант run
+template <typename T>
+T PickFastest(const std::vector<T> &candidates,
+              const std::function<void(S21TuningParameters &, T)> &apply,
+              const std::function<void()> &run, int repetitions) {
+  T best = candidates.front();
+  double best_time = std::numeric_limits<double>::max();
+  for (T candidate : candidates) {
+    S21TuningParameters parameters = S21GetTuning();
+    apply(parameters, candidate);
+    S21SetTuning(parameters);
+    double time = Measure(run, repetitions);
+    if (time < best_time) {
+      best_time = time;
+      best = candidate;
+    }
+  }
+  S21TuningParameters parameters = S21GetTuning();
+  apply(parameters, best);
+  S21SetTuning(parameters);
+  return best;
+}
+
+}  // namespace
+
+S21TuningParameters S21GetTuning() {
+  LoadFromEnvironment();
+  return Current().Load();
+}
+
+void S21SetTuning(const S21TuningParameters &parameters) {
+  if (!IsValid(parameters)) {
+    throw S21ArgumentError("Invalid tuning parameters");
+  }
+  LoadFromEnvironment();
+  std::lock_guard<std::mutex> lock(tuning_mutex);
+  Current().Store(parameters);
+}
+
+bool S21LoadTuning(const std::string &path) {
+  // Файл из окружения читается раньше, чтобы не перекрыть этот при первом
+  // S21GetTuning
+  LoadFromEnvironment();
+  return ApplyTuningFile(path);
+}
+
+void S21SaveTuning(const std::string &path) {
+  S21TuningParameters parameters = S21GetTuning();
+  std::ofstream file(path);
+  file << "# S21Matrix tuning\n"
+       << "parallel_elements = " << parameters.parallel_elements << "\n"
+       << "reduce_block_elements = " << parameters.reduce_block_elements
+       << "\n"
+       << "blocked_multiply_min = " << parameters.blocked_multiply_min
+       << "\n"
+       << "multiply_tile = " << parameters.multiply_tile << "\n";
+  if (!file) {
+    throw S21SystemError("Cannot write tuning file");
+  }
+}
+
+S21TuningParameters S21Autotune(const S21AutotuneOptions &options) {
+  if (options.matrix_size < 16 || options.repetitions < 1) {
+    throw S21ArgumentError("Invalid autotune options");
+  }
+  int size = options.matrix_size;
+  int repetitions = options.repetitions;
+  S21Matrix a(size, size);
+  a.Generate([](int i, int j) { return ((i * 7 + j * 3) % 11) * 0.1; });
+  S21Vector x(size);
+  x.Fill(1);
+  S21Vector y(size);
+
+  PickFastest<int>(
+      {1 << 12, 1 << 13, 1 << 14, 1 << 15, 1 << 16, 1 << 17},
+      [](S21TuningParameters &p, int value) { p.parallel_elements = value; },
+      [&] {
+        a.Fill(0.5);
+        Gemv(y, a, x);
+        Gemv(y, a, x, 1.0, 0.0, true);
+      },
+      repetitions);
+  PickFastest<int>(
+      {1 << 12, 1 << 13, 1 << 14, 1 << 15, 1 << 16, 1 << 17},
+      [](S21TuningParameters &p, int value) {
+        p.reduce_block_elements = value;
+      },
+      [&] {
+        Sum(a);
+        Dot(x, x);
+      },
+      repetitions);
+
+  // Тайл подбирается на заведомо блочном умножении
+  S21Matrix b(a), c;
+  S21TuningParameters forced = S21GetTuning();
+  forced.blocked_multiply_min = 0;
+  S21SetTuning(forced);
+  int tile = PickFastest<int>(
+      {16, 32, 64, 128},
+      [](S21TuningParameters &p, int value) { p.multiply_tile = value; },
+      [&] { Multiply(c, a, b); }, repetitions);
+
+  // Порог — наименьший размер, с которого блочный вариант не медленнее
+  // простого на всех следующих размерах
+  S21TuningParameters parameters = S21GetTuning();
+  parameters.multiply_tile = tile;
+  long long threshold = -1;
+  long long largest = 0;
+  for (int n = std::min(size, 2 * tile); n >= 8; n /= 2) {
+    long long volume = static_cast<long long>(n) * n * n;
+    largest = std::max(largest, volume);
+    S21Matrix left(n, n), right(n, n), out;
+    left.Fill(1);
+    right.Fill(1);
+    parameters.blocked_multiply_min = std::numeric_limits<long long>::max();
+    S21SetTuning(parameters);
+    double naive = Measure([&] { Multiply(out, left, right); }, repetitions);
+    parameters.blocked_multiply_min = 0;
+    S21SetTuning(parameters);
+    double blocked = Measure([&] { Multiply(out, left, right); }, repetitions);
+    if (blocked > naive) {
+      break;
+    }
+    threshold = volume;
+  }
+  // Если блочный вариант проиграл уже на самом большом размере, он
+  // включается только за пределами замеренного
+  parameters.blocked_multiply_min = threshold >= 0 ? threshold : largest + 1;
+  S21SetTuning(parameters);
+  return parameters;
+}
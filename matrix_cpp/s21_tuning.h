@@ -0,0 +1,48 @@
+#ifndef S21_TUNING_H
+#define S21_TUNING_H
+
+#include <string>
+
+// Параметры производительности ядер. Значения по умолчанию подходят для
+// большинства машин; S21Autotune подбирает их под конкретный процессор
+struct S21TuningParameters {
+  // Задачи меньше этого числа элементов выполняются в вызывающем потоке, а
+  // большие делятся между потоками кусками примерно такого размера
+  int parallel_elements = 1 << 15;
+  // Размер фиксированного блока в суммах и скалярных произведениях.
+  // От него зависит порядок сложения, но не от числа потоков
+  int reduce_block_elements = 1 << 15;
+  // Multiply переходит на блочный алгоритм, когда m * n * k не меньше
+  // этого порога
+  long long blocked_multiply_min = 1 << 18;
+  // Сторона квадратного тайла блочного умножения
+  int multiply_tile = 64;
+};
+
+// Параметры при первом обращении загружаются из файла, указанного в
+// переменной окружения S21_MATRIX_TUNING; без нее или при ошибке чтения
+// действуют значения по умолчанию
+S21TuningParameters S21GetTuning();
+void S21SetTuning(const S21TuningParameters &parameters);
+
+// Файл из строк "ключ = значение", ключи совпадают с именами полей, '#'
+// начинает комментарий. Неизвестные ключи и некорректные значения
+// пропускаются, для них остаются текущие значения. Файл из
+// S21_MATRIX_TUNING применяется раньше, так что явно загруженный файл
+// перекрывает его. Возвращает false, если файл не удалось открыть
+bool S21LoadTuning(const std::string &path);
+void S21SaveTuning(const std::string &path);
+
+struct S21AutotuneOptions {
+  // Сторона матриц, на которых идут замеры
+  int matrix_size = 256;
+  // Каждый вариант запускается столько раз, берется лучшее время
+  int repetitions = 3;
+};
+
+// Замеряет варианты параметров на этой машине, устанавливает лучшие через
+// S21SetTuning и возвращает их. Результат сохраняется S21SaveTuning
+S21TuningParameters S21Autotune(
+    const S21AutotuneOptions &options = S21AutotuneOptions());
+
+#endif
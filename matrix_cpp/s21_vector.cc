@@ -0,0 +1,234 @@
+#include "s21_vector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "s21_allocator.h"
+#include "s21_thread_pool.h"
+#include "s21_tuning.h"
+
+namespace {
+
+// Четыре независимых аккумулятора разрывают цепочку зависимостей сложения и
+// позволяют компилятору векторизовать цикл
+double KernelDot(const double *x, const double *y, int size) {
+  double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  int i = 0;
+  for (; i + 4 <= size; i += 4) {
+    s0 += x[i] * y[i];
+    s1 += x[i + 1] * y[i + 1];
+    s2 += x[i + 2] * y[i + 2];
+    s3 += x[i + 3] * y[i + 3];
+  }
+  for (; i < size; i++) s0 += x[i] * y[i];
+  return (s0 + s1) + (s2 + s3);
+}
+
+void KernelAxpy(double alpha, const double *x, double *y, int size) {
+  for (int i = 0; i < size; i++) y[i] += alpha * x[i];
+}
+
+// Разбиение [0, size) на куски по block элементов для ParallelFor
+void ForBlocks(int size, int block,
+               const std::function<void(int, int)> &body) {
+  int blocks = (size + block - 1) / block;
+  if (blocks <= 1) {
+    body(0, size);
+    return;
+  }
+  S21ThreadPool::Instance().ParallelFor(0, blocks, 1, [&](int from, int to) {
+    body(from * block, std::min(size, to * block));
+  });
+}
+
+}  // namespace
+
+S21Vector::S21Vector() : size_(0), data_(nullptr) {}
+
+S21Vector::S21Vector(int size) : size_(size), data_(nullptr) {
+  if (size < 0) throw S21SizeError("Invalid vector size");
+  data_ = S21AllocateBuffer(size);
+  std::fill(data_, data_ + size, 0.0);
+}
+
+S21Vector::S21Vector(int size, const double *data) : S21Vector(size) {
+  std::copy(data, data + size, data_);
+}
+
+S21Vector::S21Vector(std::initializer_list<double> values)
+    : S21Vector(static_cast<int>(values.size())) {
+  std::copy(values.begin(), values.end(), data_);
+}
+
+S21Vector::S21Vector(const S21Matrix &matrix) : S21Vector() {
+  if (matrix.GetRows() != 1 && matrix.GetCols() != 1) {
+    throw S21SizeError("Matrix is not a vector");
+  }
+  *this = S21Vector(matrix.GetRows() * matrix.GetCols());
+  matrix.CopyTo(data_);
+}
+
+S21Vector::S21Vector(const S21Vector &other)
+    : S21Vector(other.size_, other.data_) {}
+
+S21Vector::S21Vector(S21Vector &&other) noexcept
+    : size_(other.size_), data_(other.data_) {
+  other.size_ = 0;
+  other.data_ = nullptr;
+}
+
+S21Vector::~S21Vector() { S21FreeBuffer(data_); }
+
+S21Vector &S21Vector::operator=(const S21Vector &other) {
+  if (this != &other) {
+    if (size_ != other.size_) *this = S21Vector(other.size_);
+    std::copy(other.data_, other.data_ + size_, data_);
+  }
+  return *this;
+}
+
+S21Vector &S21Vector::operator=(S21Vector &&other) noexcept {
+  std::swap(size_, other.size_);
+  std::swap(data_, other.data_);
+  return *this;
+}
+
+bool S21Vector::operator==(const S21Vector &other) const {
+  if (size_ != other.size_) return false;
+  for (int i = 0; i < size_; i++) {
+    if (fabs(data_[i] - other.data_[i]) > 1e-7) return false;
+  }
+  return true;
+}
+
+int S21Vector::GetSize() const { return size_; }
+
+double *S21Vector::GetData() { return data_; }
+
+const double *S21Vector::GetData() const { return data_; }
+
+double &S21Vector::operator()(int i) {
+  if (i < 0 || i >= size_) throw S21IndexError("Index out of range");
+  return data_[i];
+}
+
+double S21Vector::operator()(int i) const {
+  if (i < 0 || i >= size_) throw S21IndexError("Index out of range");
+  return data_[i];
+}
+
+void S21Vector::Resize(int size) {
+  S21Vector result(size);
+  std::copy(data_, data_ + std::min(size, size_), result.data_);
+  *this = std::move(result);
+}
+
+void S21Vector::Fill(double value) { std::fill(data_, data_ + size_, value); }
+
+S21Matrix S21Vector::ToColumn() const { return S21Matrix(size_, 1, data_); }
+
+S21Matrix S21Vector::ToRow() const { return S21Matrix(1, size_, data_); }
+
+double Dot(const S21Vector &x, const S21Vector &y) {
+  if (x.GetSize() != y.GetSize()) throw S21SizeError("Wrong vector size");
+  int size = x.GetSize();
+  int block = S21GetTuning().reduce_block_elements;
+  int blocks = std::max(1, (size + block - 1) / block);
+  std::vector<double> partials(blocks);
+  ForBlocks(size, block, [&](int from, int to) {
+    for (int begin = from; begin < to; begin += block) {
+      int end = std::min(to, begin + block);
+      partials[begin / block] =
+          KernelDot(x.GetData() + begin, y.GetData() + begin, end - begin);
+    }
+  });
+  double result = 0;
+  for (double partial : partials) result += partial;
+  return result;
+}
+
+double Norm2(const S21Vector &x) { return sqrt(Dot(x, x)); }
+
+void Axpy(double alpha, const S21Vector &x, S21Vector &y) {
+  if (x.GetSize() != y.GetSize()) throw S21SizeError("Wrong vector size");
+  ForBlocks(x.GetSize(), S21GetTuning().parallel_elements,
+            [&](int from, int to) {
+    KernelAxpy(alpha, x.GetData() + from, y.GetData() + from, to - from);
+  });
+}
+
+void Gemv(S21Vector &y, const S21Matrix &a, const S21Vector &x, double alpha,
+          double beta, bool trans) {
+  int rows = a.GetRows();
+  int cols = a.GetCols();
+  int m = trans ? cols : rows;
+  if (x.GetSize() != (trans ? rows : cols)) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  if (beta != 0 && y.GetSize() != m) throw S21SizeError("Wrong vector size");
+  if (&y == &x) {
+    S21Vector temp(y);
+    Gemv(temp, a, x, alpha, beta, trans);
+    y = std::move(temp);
+    return;
+  }
+  if (y.GetSize() != m) y = S21Vector(m);
+  double *out = y.GetData();
+  const double *in = x.GetData();
+  S21ThreadPool &pool = S21ThreadPool::Instance();
+  int parallel_elements = S21GetTuning().parallel_elements;
+  if (!trans) {
+    // Строка a на x: скалярное произведение с единичным шагом
+    int grain = std::max(1, parallel_elements / std::max(1, cols));
+    pool.ParallelFor(0, rows, grain, [&](int from, int to) {
+      for (int i = from; i < to; i++) {
+        double value = alpha * KernelDot(a.GetRowData(i), in, cols);
+        out[i] = beta == 0 ? value : value + beta * out[i];
+      }
+    });
+    return;
+  }
+  // a^T * x — сумма строк a с весами x. Потоки делят между собой столбцы,
+  // поэтому каждый пишет в свой кусок y и проходит строки подряд
+  int grain = std::max(1, parallel_elements / std::max(1, rows));
+  pool.ParallelFor(0, cols, grain, [&](int from, int to) {
+    for (int j = from; j < to; j++) out[j] = beta == 0 ? 0 : beta * out[j];
+    for (int i = 0; i < rows; i++) {
+      KernelAxpy(alpha * in[i], a.GetRowData(i) + from, out + from, to - from);
+    }
+  });
+}
+
+void Ger(S21Matrix &a, double alpha, const S21Vector &x, const S21Vector &y) {
+  int rows = a.GetRows();
+  int cols = a.GetCols();
+  if (x.GetSize() != rows || y.GetSize() != cols) {
+    throw S21SizeError("Wrong matrix size");
+  }
+  // Неконстантный доступ меняет версию матрицы, поэтому адрес берется до
+  // запуска потоков
+  double *data = a.GetData();
+  int stride = a.GetStride();
+  int grain = std::max(1, S21GetTuning().parallel_elements / std::max(1, cols));
+  S21ThreadPool::Instance().ParallelFor(0, rows, grain, [&](int from, int to) {
+    for (int i = from; i < to; i++) {
+      KernelAxpy(alpha * x.GetData()[i], y.GetData(),
+                 data + (long long)i * stride, cols);
+    }
+  });
+}
+
+S21Vector operator*(const S21Matrix &a, const S21Vector &x) {
+  S21Vector result;
+  Gemv(result, a, x);
+  return result;
+}
+
+S21Vector operator*(const S21Vector &x, const S21Matrix &a) {
+  S21Vector result;
+  Gemv(result, a, x, 1.0, 0.0, true);
+  return result;
+}
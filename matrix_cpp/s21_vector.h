@@ -0,0 +1,62 @@
+#ifndef S21_VECTOR_H
+#define S21_VECTOR_H
+
+#include <initializer_list>
+
+#include "s21_matrix_oop.h"
+
+// Плотный вектор в одном выровненном блоке памяти
+class S21Vector {
+ public:
+  S21Vector();
+  explicit S21Vector(int size);
+  S21Vector(int size, const double *data);
+  S21Vector(std::initializer_list<double> values);
+  // Матрица из одной строки или одного столбца
+  explicit S21Vector(const S21Matrix &matrix);
+  S21Vector(const S21Vector &other);
+  S21Vector(S21Vector &&other) noexcept;
+  ~S21Vector();
+
+  S21Vector &operator=(const S21Vector &other);
+  S21Vector &operator=(S21Vector &&other) noexcept;
+  bool operator==(const S21Vector &other) const;
+
+  int GetSize() const;
+  double *GetData();
+  const double *GetData() const;
+  double &operator()(int i);
+  double operator()(int i) const;
+
+  // Сохраняет первые min(size, GetSize()) элементов, новые заполняет нулями
+  void Resize(int size);
+  void Fill(double value);
+  // Матрица size x 1 и 1 x size
+  S21Matrix ToColumn() const;
+  S21Matrix ToRow() const;
+
+ private:
+  int size_;
+  double *data_;
+};
+
+// Ядра уровней BLAS-1 и BLAS-2. Длинные циклы идут с единичным шагом по
+// памяти и делятся между потоками пула фиксированными кусками, так что
+// результат не зависит от числа потоков
+
+double Dot(const S21Vector &x, const S21Vector &y);
+double Norm2(const S21Vector &x);
+// y += alpha * x
+void Axpy(double alpha, const S21Vector &x, S21Vector &y);
+// y = alpha * op(a) * x + beta * y, op(a) = a или a^T. При beta == 0
+// содержимое y не читается и y получает нужный размер
+void Gemv(S21Vector &y, const S21Matrix &a, const S21Vector &x,
+          double alpha = 1.0, double beta = 0.0, bool trans = false);
+// a += alpha * x * y^T
+void Ger(S21Matrix &a, double alpha, const S21Vector &x, const S21Vector &y);
+
+// a * x и x^T * a
+S21Vector operator*(const S21Matrix &a, const S21Vector &x);
+S21Vector operator*(const S21Vector &x, const S21Matrix &a);
+
+#endif
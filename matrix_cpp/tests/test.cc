@@ -1,6 +1,32 @@
 #include <gtest/gtest.h>
 
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <fstream>
+#include <list>
+#include <thread>
+#include <vector>
+
+#include "../s21_allocator.h"
+#include "../s21_distributed.h"
+#include "../s21_iterative_solver.h"
+#include "../s21_low_rank.h"
+#include "../s21_matrix_async.h"
+#include "../s21_matrix_cache.h"
+#include "../s21_matrix_chain.h"
+#include "../s21_matrix_decompose.h"
+#include "../s21_matrix_map.h"
 #include "../s21_matrix_oop.h"
+#include "../s21_matrix_reduce.h"
+#include "../s21_matrix_status.h"
+#include "../s21_shared_matrix.h"
+#include "../s21_shared_memory.h"
+#include "../s21_structured_matrix.h"
+#include "../s21_thread_pool.h"
+#include "../s21_tuning.h"
+#include "../s21_vector.h"
 
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
@@ -79,7 +105,7 @@ TEST(sum_wrong_size, True) {
   S21Matrix b(2, 2);
   try {
     a.SumMatrix(b);
-  } catch (const char *err) {
+  } catch (const S21MatrixError &err) {
   }
 }
 
@@ -126,7 +152,7 @@ TEST(sub_wrong_size, True) {
   S21Matrix b(2, 2);
   try {
     a.SubMatrix(b);
-  } catch (const char *err) {
+  } catch (const S21MatrixError &err) {
   }
 }
 
@@ -168,7 +194,6 @@ TEST(mult_loop, True) {
   }
   a.MulMatrix(b);
   ASSERT_TRUE(a == check);
-  a.~S21Matrix();
 }
 
 TEST(mult, True) {
@@ -198,7 +223,7 @@ TEST(mult_matrix_wrong_size, True) {
   S21Matrix b(2, 2);
   try {
     a.MulMatrix(b);
-  } catch (const char *err) {
+  } catch (const S21MatrixError &err) {
   }
 }
 
@@ -254,7 +279,7 @@ TEST(complements_wrong_size, True) {
   S21Matrix a(3, 2);
   try {
     a.CalcComplements();
-  } catch (const char *err) {
+  } catch (const S21MatrixError &err) {
   }
 }
 
@@ -415,7 +440,7 @@ TEST(determinant_wrong_size, True) {
   S21Matrix a(3, 2);
   try {
     a.Determinant();
-  } catch (const char *err) {
+  } catch (const S21MatrixError &err) {
   }
 }
 
@@ -478,7 +503,7 @@ TEST(inverse_wrong_size, True) {
   }
   try {
     m.InverseMatrix();
-  } catch (const char *err) {
+  } catch (const S21MatrixError &err) {
   }
 }
 
@@ -703,6 +728,1458 @@ TEST(braces_out_of_range, True) {
   try {
     double n = m(5, 5);
     ASSERT_TRUE(1 == n);
-  } catch (const char *err) {
+  } catch (const S21MatrixError &err) {
   }
-}
\ No newline at end of file
+}
+TEST(gemm_out, True) {
+  S21Matrix a(2, 3);
+  S21Matrix b(3, 2);
+  S21Matrix out;
+  S21Matrix check(2, 2);
+  for (int i = 0, c = 1; i < 2; i++)
+    for (int j = 0; j < 3; j++) a.SetMatrixMember(i, j, c++);
+  for (int i = 0, c = 7; i < 3; i++)
+    for (int j = 0; j < 2; j++) b.SetMatrixMember(i, j, c++);
+  check.SetMatrixMember(0, 0, 58);
+  check.SetMatrixMember(0, 1, 64);
+  check.SetMatrixMember(1, 0, 139);
+  check.SetMatrixMember(1, 1, 154);
+  Multiply(out, a, b);
+  ASSERT_TRUE(out == check);
+}
+
+TEST(gemm_transposed, True) {
+  const int rows = rand() % 20 + 1;
+  const int cols = rand() % 20 + 1;
+  S21Matrix a(rows, cols);
+  S21Matrix b(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      a.SetMatrixMember(i, j, rand() % 100 + 1);
+      b.SetMatrixMember(i, j, rand() % 100 + 1);
+    }
+  }
+  S21Matrix check = a.Transpose() * b;
+  S21Matrix out;
+  Multiply(out, a, b, 1.0, 0.0, true, false);
+  ASSERT_TRUE(out == check);
+  check = a * b.Transpose();
+  Multiply(out, a, b, 1.0, 0.0, false, true);
+  ASSERT_TRUE(out == check);
+  S21Matrix bt = b.Transpose();
+  check = a.Transpose() * bt.Transpose();
+  Multiply(out, a, bt, 1.0, 0.0, true, true);
+  ASSERT_TRUE(out == check);
+}
+
+TEST(gemm_accumulate_reuses_buffer, True) {
+  S21Matrix a(3, 3);
+  S21Matrix out(3, 3);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      a.SetMatrixMember(i, j, i + j);
+      out.SetMatrixMember(i, j, 1);
+    }
+  }
+  S21Matrix check = a * a * 2.0;
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      check.SetMatrixMember(i, j, check.GetMatrixMember(i, j) + 3);
+  double *first = &out(0, 0);
+  Multiply(out, a, a, 2.0, 3.0);
+  ASSERT_TRUE(out == check);
+  ASSERT_TRUE(first == &out(0, 0));
+}
+
+TEST(gemm_aliased_out, True) {
+  S21Matrix a(2, 2);
+  a.SetMatrixMember(0, 0, 1);
+  a.SetMatrixMember(0, 1, 2);
+  a.SetMatrixMember(1, 0, 3);
+  a.SetMatrixMember(1, 1, 4);
+  S21Matrix check = a * a;
+  Multiply(a, a, a);
+  ASSERT_TRUE(a == check);
+}
+
+TEST(mul_matrix_in_place_reuses_buffers, True) {
+  S21Matrix a{{1, 1}, {0, 1}};
+  S21Matrix m = a;
+  m.MulMatrix(a);
+  const double *first = &m(0, 0);
+  m.MulMatrix(a);
+  const double *second = &m(0, 0);
+  m.MulMatrix(a);
+  // Память out и буфер потока меняются местами, новых блоков нет
+  ASSERT_TRUE(&m(0, 0) == first);
+  m.MulMatrix(a);
+  ASSERT_TRUE(&m(0, 0) == second);
+  ASSERT_TRUE(m == S21Matrix({{1, 5}, {0, 1}}));
+}
+
+TEST(gemm_wrong_size, True) {
+  S21Matrix a(2, 3);
+  S21Matrix b(2, 3);
+  S21Matrix out;
+  EXPECT_ANY_THROW(Multiply(out, a, b));
+  S21Matrix c(3, 2);
+  EXPECT_ANY_THROW(Multiply(out, a, c, 1.0, 1.0));
+}
+
+TEST(add_sub_scale_out, True) {
+  const int rows = rand() % 100 + 1;
+  const int cols = rand() % 100 + 1;
+  S21Matrix a(rows, cols);
+  S21Matrix b(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      a.SetMatrixMember(i, j, rand() % 100 + 1);
+      b.SetMatrixMember(i, j, rand() % 100 + 1);
+    }
+  }
+  S21Matrix out(rows, cols);
+  double *first = &out(0, 0);
+  Add(out, a, b);
+  ASSERT_TRUE(out == a + b);
+  Sub(out, a, b);
+  ASSERT_TRUE(out == a - b);
+  Scale(out, a, 3);
+  ASSERT_TRUE(out == a * 3.0);
+  ASSERT_TRUE(first == &out(0, 0));
+  S21Matrix c(1, 1);
+  EXPECT_ANY_THROW(Add(out, a, c));
+  EXPECT_ANY_THROW(Sub(out, a, c));
+}
+
+TEST(chain_tall_wide, True) {
+  S21Matrix a(100, 2);
+  S21Matrix b(2, 100);
+  S21Matrix v(100, 1);
+  for (int i = 0; i < 100; i++) {
+    for (int j = 0; j < 2; j++) {
+      a.SetMatrixMember(i, j, rand() % 10);
+      b.SetMatrixMember(j, i, rand() % 10);
+    }
+    v.SetMatrixMember(i, 0, rand() % 10);
+  }
+  S21MatrixChain chain = S21MatrixChain(a) * b * v;
+  ASSERT_EQ(chain.GetSize(), 3);
+  ASSERT_EQ(chain.NaiveCost(), 30000);
+  ASSERT_EQ(chain.Cost(), 400);
+  ASSERT_EQ(chain.Plan(), "(A0*(A1*A2))");
+  S21Matrix check;
+  Multiply(check, a, b);
+  Multiply(check, S21Matrix(check), v);
+  ASSERT_TRUE(chain.Evaluate() == check);
+}
+
+TEST(chain_common_subexpression, True) {
+  S21Matrix a(2, 3);
+  S21Matrix b(3, 2);
+  for (int i = 0; i < 2; i++) {
+    for (int j = 0; j < 3; j++) {
+      a.SetMatrixMember(i, j, i + j);
+      b.SetMatrixMember(j, i, i - j);
+    }
+  }
+  S21MatrixChain chain(a);
+  chain.Append(b).Append(a).Append(b).Append(b, true);
+  S21Matrix ab;
+  Multiply(ab, a, b);
+  S21Matrix check;
+  Multiply(check, ab, ab);
+  Multiply(check, S21Matrix(check), b, 1.0, 0.0, false, true);
+  S21Matrix out(2, 3);
+  chain.Evaluate(out);
+  ASSERT_TRUE(out == check);
+}
+
+TEST(chain_single_and_errors, True) {
+  S21Matrix a(2, 3);
+  a.SetMatrixMember(0, 2, 5);
+  S21MatrixChain single(a, true);
+  S21Matrix out = single.Evaluate();
+  ASSERT_TRUE(out == a.Transpose());
+  ASSERT_EQ(single.Cost(), 0);
+  S21MatrixChain chain(a);
+  EXPECT_ANY_THROW(chain.Append(a));
+  S21MatrixChain empty;
+  EXPECT_ANY_THROW(empty.Evaluate());
+}
+
+S21Matrix Product(const S21Matrix &a, const S21Matrix &b) {
+  S21Matrix result;
+  Multiply(result, a, b);
+  return result;
+}
+
+TEST(diagonal_matrix, True) {
+  S21DiagonalMatrix d(3);
+  S21Matrix a(3, 2);
+  for (int i = 0; i < 3; i++) {
+    d.SetMatrixMember(i, i, i + 2);
+    for (int j = 0; j < 2; j++) a.SetMatrixMember(i, j, rand() % 10 + 1);
+  }
+  S21Matrix dense = d.ToDense();
+  ASSERT_TRUE(d * a == Product(dense, a));
+  S21Matrix at = a.Transpose();
+  ASSERT_TRUE(at * d == Product(at, dense));
+  ASSERT_DOUBLE_EQ(d.Determinant(), 24);
+  ASSERT_TRUE(d * d.Solve(a) == a);
+  ASSERT_TRUE(d.Transpose().ToDense() == dense);
+  EXPECT_ANY_THROW(d.SetMatrixMember(0, 1, 1));
+  EXPECT_ANY_THROW(d * at);
+}
+
+TEST(triangular_matrix, True) {
+  for (int upper = 0; upper < 2; upper++) {
+    S21TriangularMatrix t(4, upper);
+    for (int i = 0; i < 4; i++) {
+      for (int j = 0; j < 4; j++) {
+        if (upper ? j >= i : j <= i) t.SetMatrixMember(i, j, rand() % 10 + 1);
+      }
+    }
+    S21Matrix dense = t.ToDense();
+    S21Matrix a(4, 3);
+    for (int i = 0; i < 4; i++)
+      for (int j = 0; j < 3; j++) a.SetMatrixMember(i, j, rand() % 10 - 5);
+    S21Matrix at = a.Transpose();
+    ASSERT_TRUE(t * a == Product(dense, a));
+    ASSERT_TRUE(at * t == Product(at, dense));
+    ASSERT_NEAR(t.Determinant(), dense.Determinant(), 1e-6);
+    ASSERT_TRUE(t * t.Solve(a) == a);
+    S21TriangularMatrix tt = t.Transpose();
+    ASSERT_TRUE(tt.IsUpper() != t.IsUpper());
+    ASSERT_TRUE(tt.ToDense() == dense.Transpose());
+    EXPECT_ANY_THROW(t.SetMatrixMember(upper ? 3 : 0, upper ? 0 : 3, 1));
+  }
+}
+
+TEST(symmetric_matrix, True) {
+  S21SymmetricMatrix s(4);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j <= i; j++) s.SetMatrixMember(i, j, rand() % 5);
+    s.SetMatrixMember(i, i, 20);
+  }
+  ASSERT_DOUBLE_EQ(s.GetMatrixMember(1, 3), s.GetMatrixMember(3, 1));
+  S21Matrix dense = s.ToDense();
+  S21Matrix a(4, 2);
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 2; j++) a.SetMatrixMember(i, j, rand() % 10 - 5);
+  S21Matrix at = a.Transpose();
+  ASSERT_TRUE(s * a == Product(dense, a));
+  ASSERT_TRUE(at * s == Product(at, dense));
+  ASSERT_NEAR(s.Determinant(), dense.Determinant(), 1e-6);
+  ASSERT_TRUE(s * s.Solve(a) == a);
+  ASSERT_TRUE(s.Transpose().ToDense() == dense);
+}
+
+TEST(symmetric_matrix_indefinite, True) {
+  S21SymmetricMatrix s(3);
+  s.SetMatrixMember(0, 1, 2);
+  s.SetMatrixMember(1, 1, 1);
+  s.SetMatrixMember(2, 2, -3);
+  s.SetMatrixMember(0, 2, 1);
+  S21Matrix dense = s.ToDense();
+  ASSERT_NEAR(s.Determinant(), dense.Determinant(), 1e-6);
+  S21Matrix b(3, 1);
+  b.SetMatrixMember(0, 0, 1);
+  b.SetMatrixMember(2, 0, 4);
+  ASSERT_TRUE(s * s.Solve(b) == b);
+  S21SymmetricMatrix zero(2);
+  EXPECT_ANY_THROW(zero.Solve(S21Matrix(2, 1)));
+}
+
+TEST(banded_matrix, True) {
+  const int n = 7;
+  S21BandedMatrix band(n, 2, 1);
+  for (int i = 0; i < n; i++) {
+    for (int j = i - 2; j <= i + 1; j++) {
+      if (j >= 0 && j < n) band.SetMatrixMember(i, j, rand() % 10 - 5);
+    }
+  }
+  band.SetMatrixMember(0, 0, 0);
+  S21Matrix dense = band.ToDense();
+  S21Matrix a(n, 3);
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < 3; j++) a.SetMatrixMember(i, j, rand() % 10 - 5);
+  S21Matrix at = a.Transpose();
+  ASSERT_TRUE(band * a == Product(dense, a));
+  ASSERT_TRUE(at * band == Product(at, dense));
+  ASSERT_NEAR(band.Determinant(), dense.Determinant(),
+              1e-6 * fabs(dense.Determinant()) + 1e-6);
+  if (fabs(band.Determinant()) > 1e-6) {
+    ASSERT_TRUE(band * band.Solve(a) == a);
+  }
+  S21BandedMatrix transposed = band.Transpose();
+  ASSERT_EQ(transposed.GetLower(), 1);
+  ASSERT_EQ(transposed.GetUpper(), 2);
+  ASSERT_TRUE(transposed.ToDense() == dense.Transpose());
+  EXPECT_ANY_THROW(band.SetMatrixMember(0, 5, 1));
+}
+
+TEST(structured_multiply_aliased_out, True) {
+  S21TriangularMatrix t(2, true);
+  t.SetMatrixMember(0, 0, 1);
+  t.SetMatrixMember(0, 1, 2);
+  t.SetMatrixMember(1, 1, 3);
+  S21Matrix a(2, 2);
+  a.SetMatrixMember(0, 0, 1);
+  a.SetMatrixMember(1, 0, 1);
+  S21Matrix check = Product(t.ToDense(), a);
+  Multiply(a, t, a);
+  ASSERT_TRUE(a == check);
+}
+
+TEST(thread_pool_parallel_for, True) {
+  S21ThreadPool pool(3);
+  std::vector<int> hits(1000, 0);
+  pool.ParallelFor(0, 1000, 10, [&](int from, int to) {
+    for (int i = from; i < to; i++) hits[i]++;
+  });
+  for (int hit : hits) ASSERT_EQ(hit, 1);
+  EXPECT_THROW(pool.ParallelFor(0, 100, 1,
+                                [](int from, int) {
+                                  if (from > 50) {
+                                    throw S21StateError("Failure");
+                                  }
+                                }),
+               S21StateError);
+}
+
+TEST(reduce_small, True) {
+  S21Matrix a(2, 3);
+  for (int i = 0, c = 1; i < 2; i++)
+    for (int j = 0; j < 3; j++) a.SetMatrixMember(i, j, c++);
+  a.SetMatrixMember(1, 2, -6);
+  ASSERT_DOUBLE_EQ(Sum(a), 9);
+  ASSERT_DOUBLE_EQ(Sum(a, true), 9);
+  ASSERT_DOUBLE_EQ(Dot(a, a), 91);
+  ASSERT_DOUBLE_EQ(FrobeniusNorm(a), sqrt(91));
+  ASSERT_DOUBLE_EQ(Norm1(a), 9);
+  ASSERT_DOUBLE_EQ(NormInf(a), 15);
+  ASSERT_DOUBLE_EQ(MaxAbs(a), 6);
+  ASSERT_DOUBLE_EQ(Min(a), -6);
+  ASSERT_DOUBLE_EQ(Max(a), 5);
+  S21Matrix out;
+  RowSums(out, a);
+  ASSERT_EQ(out.GetRows(), 2);
+  ASSERT_DOUBLE_EQ(out(0, 0), 6);
+  ASSERT_DOUBLE_EQ(out(1, 0), 3);
+  ColSums(out, a);
+  ASSERT_EQ(out.GetCols(), 3);
+  ASSERT_DOUBLE_EQ(out(0, 0), 5);
+  ASSERT_DOUBLE_EQ(out(0, 2), -3);
+  EXPECT_ANY_THROW(Trace(a));
+  EXPECT_ANY_THROW(Dot(a, S21Matrix(3, 2)));
+  EXPECT_ANY_THROW(Min(S21Matrix()));
+}
+
+TEST(reduce_row_sums_parallel, True) {
+  // Строк больше, чем в одном куске, поэтому работает параллельная ветка
+  const int rows = 20000;
+  const int cols = 64;
+  S21Matrix a(rows, cols);
+  a.Generate([](int i, int j) { return i % 7 + (j == 0); });
+  S21Matrix out;
+  RowSums(out, a);
+  ASSERT_EQ(out.GetRows(), rows);
+  for (int i = 0; i < rows; i++) ASSERT_EQ(out(i, 0), (i % 7) * cols + 1);
+}
+
+TEST(reduce_aliased_out, True) {
+  S21Matrix m(3, 3);
+  m.Fill(2);
+  RowSums(m, m);
+  ASSERT_EQ(m.GetRows(), 3);
+  ASSERT_EQ(m.GetCols(), 1);
+  for (int i = 0; i < 3; i++) ASSERT_DOUBLE_EQ(m(i, 0), 6);
+  m = S21Matrix{{1, 2}, {3, 4}};
+  ColSums(m, m);
+  ASSERT_TRUE(m == S21Matrix({{4, 6}}));
+}
+
+TEST(reduce_large, True) {
+  const int rows = 700;
+  const int cols = 300;
+  S21Matrix a(rows, cols);
+  double sum = 0, squares = 0, max_abs = 0;
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      double value = rand() % 1000 - 500;
+      a.SetMatrixMember(i, j, value);
+      sum += value;
+      squares += value * value;
+      max_abs = std::max(max_abs, fabs(value));
+    }
+  }
+  ASSERT_DOUBLE_EQ(Sum(a), sum);
+  ASSERT_DOUBLE_EQ(Sum(a, true), sum);
+  ASSERT_DOUBLE_EQ(Dot(a, a, true), squares);
+  ASSERT_DOUBLE_EQ(MaxAbs(a), max_abs);
+  S21MatrixStats stats = Statistics(a);
+  ASSERT_DOUBLE_EQ(stats.sum, sum);
+  ASSERT_DOUBLE_EQ(stats.sum_squares, squares);
+  ASSERT_DOUBLE_EQ(stats.max_abs, max_abs);
+  S21Matrix square(3, 3);
+  square.SetMatrixMember(0, 0, 1);
+  square.SetMatrixMember(1, 1, 2);
+  square.SetMatrixMember(2, 2, 3);
+  ASSERT_DOUBLE_EQ(Trace(square), 6);
+}
+
+TEST(reduce_compensated, True) {
+  S21Matrix a(1, 4);
+  a.SetMatrixMember(0, 0, 1e16);
+  a.SetMatrixMember(0, 1, 1);
+  a.SetMatrixMember(0, 2, -1e16);
+  a.SetMatrixMember(0, 3, 1);
+  ASSERT_DOUBLE_EQ(Sum(a, true), 2);
+}
+
+TEST(bulk_construct, True) {
+  S21Matrix a{{1, 2, 3}, {4, 5, 6}};
+  ASSERT_EQ(a.GetRows(), 2);
+  ASSERT_EQ(a.GetCols(), 3);
+  ASSERT_DOUBLE_EQ(a(1, 0), 4);
+  S21Matrix b(2, 3, {1, 2, 3, 4, 5, 6});
+  ASSERT_TRUE(a == b);
+  double column_major[] = {1, 4, 2, 5, 3, 6};
+  S21Matrix c(2, 3, column_major, S21Layout::kColumnMajor);
+  ASSERT_TRUE(a == c);
+  std::list<double> values = {1, 2, 3, 4, 5, 6};
+  S21Matrix d(2, 3, values.begin(), values.end());
+  ASSERT_TRUE(a == d);
+  EXPECT_ANY_THROW(S21Matrix(2, 2, values.begin(), values.end()));
+  EXPECT_ANY_THROW(S21Matrix(2, 4, {1, 2, 3}));
+  EXPECT_ANY_THROW(S21Matrix({{1, 2}, {3}}));
+}
+
+TEST(bulk_assign_export, True) {
+  const int rows = 300;
+  const int cols = 250;
+  std::vector<double> source(rows * cols);
+  for (int i = 0; i < rows * cols; i++) source[i] = i;
+  S21Matrix a(rows, cols);
+  a.Assign(source.data());
+  ASSERT_DOUBLE_EQ(a(7, 3), 7 * cols + 3);
+  std::vector<double> exported(rows * cols);
+  a.CopyTo(exported.data());
+  ASSERT_TRUE(exported == source);
+  a.CopyTo(exported.data(), S21Layout::kColumnMajor);
+  ASSERT_DOUBLE_EQ(exported[3 * rows + 7], 7 * cols + 3);
+  S21Matrix b(rows, cols);
+  b.Assign(exported.begin(), exported.end(), S21Layout::kColumnMajor);
+  ASSERT_TRUE(a == b);
+  ASSERT_DOUBLE_EQ(b.GetData()[rows * cols - 1], rows * cols - 1);
+}
+
+TEST(bulk_fill_generate, True) {
+  S21Matrix a(400, 200);
+  a.Fill(2.5);
+  ASSERT_DOUBLE_EQ(a(399, 199), 2.5);
+  a.Generate([](int i, int j) { return i * 1000.0 + j; });
+  for (int i = 0; i < 400; i += 37) {
+    for (int j = 0; j < 200; j += 13) {
+      ASSERT_DOUBLE_EQ(a(i, j), i * 1000.0 + j);
+    }
+  }
+}
+
+TEST(append_rows_amortized, True) {
+  S21Matrix a;
+  S21Matrix batch{{1, 2, 3}};
+  int regrows = 0;
+  const double *data = nullptr;
+  for (int i = 0; i < 1000; i++) {
+    batch(0, 0) = i;
+    a.AppendRows(batch);
+    if (a.GetData() != data) {
+      regrows++;
+      data = a.GetData();
+    }
+  }
+  ASSERT_EQ(a.GetRows(), 1000);
+  ASSERT_EQ(a.GetCols(), 3);
+  ASSERT_LE(regrows, 11);
+  ASSERT_DOUBLE_EQ(a(999, 0), 999);
+  ASSERT_DOUBLE_EQ(a(500, 2), 3);
+  double raw[] = {7, 8, 9, 10, 11, 12};
+  a.AppendRows(raw, 2);
+  ASSERT_DOUBLE_EQ(a(1001, 2), 12);
+  a.AppendRows(a);
+  ASSERT_EQ(a.GetRows(), 2004);
+  ASSERT_DOUBLE_EQ(a(2003, 2), 12);
+  EXPECT_ANY_THROW(a.AppendRows(S21Matrix(1, 2)));
+  a.ShrinkToFit();
+  ASSERT_EQ(a.GetRowCapacity(), 2004);
+  ASSERT_EQ(a.GetStride(), 3);
+}
+
+TEST(append_cols, True) {
+  S21Matrix a{{1}, {2}};
+  S21Matrix b{{3, 4}, {5, 6}};
+  a.AppendCols(b);
+  ASSERT_TRUE(a == S21Matrix({{1, 3, 4}, {2, 5, 6}}));
+  a.AppendCols(a);
+  ASSERT_TRUE(a == S21Matrix({{1, 3, 4, 1, 3, 4}, {2, 5, 6, 2, 5, 6}}));
+  S21Matrix empty;
+  empty.AppendCols(b);
+  ASSERT_TRUE(empty == b);
+  EXPECT_ANY_THROW(a.AppendCols(S21Matrix(3, 1)));
+}
+
+TEST(resize_reserve, True) {
+  S21Matrix a{{1, 2}, {3, 4}};
+  a.Reserve(10, 10);
+  const double *data = a.GetData();
+  ASSERT_EQ(a.GetRowCapacity(), 10);
+  ASSERT_TRUE(a == S21Matrix({{1, 2}, {3, 4}}));
+  a.Resize(3, 3);
+  ASSERT_TRUE(a == S21Matrix({{1, 2, 0}, {3, 4, 0}, {0, 0, 0}}));
+  a.Resize(1, 1);
+  a.Resize(2, 2);
+  ASSERT_TRUE(a == S21Matrix({{1, 0}, {0, 0}}));
+  ASSERT_EQ(data, a.GetData());
+  a.SetRows(3);
+  a.SetCols(1);
+  ASSERT_EQ(a.GetRows(), 3);
+  ASSERT_EQ(a.GetCols(), 1);
+  ASSERT_DOUBLE_EQ(a(0, 0), 1);
+  EXPECT_ANY_THROW(a.Resize(-1, 2));
+  S21Matrix copy(a);
+  ASSERT_TRUE(copy == a);
+  ASSERT_EQ(copy.GetStride(), 1);
+}
+
+TEST(reserved_matrix_kernels, True) {
+  S21Matrix a{{1, 2}, {3, 4}};
+  a.Reserve(4, 5);
+  S21Matrix out;
+  Multiply(out, a, a);
+  ASSERT_TRUE(out == S21Matrix({{7, 10}, {15, 22}}));
+  ASSERT_DOUBLE_EQ(Sum(a), 10);
+  double exported[4];
+  a.CopyTo(exported);
+  ASSERT_DOUBLE_EQ(exported[3], 4);
+  S21Matrix b(2, 2);
+  b.Reserve(4, 4);
+  b = a;
+  ASSERT_TRUE(b == a);
+}
+
+TEST(async_pipeline, True) {
+  S21Task<S21Matrix> a = S21Async([] { return S21Matrix{{1, 2}, {3, 4}}; });
+  S21Task<S21Matrix> b = S21Async([] { return S21Matrix{{0, 1}, {1, 0}}; });
+  S21Task<S21Matrix> product = MultiplyAsync(a, b);
+  S21Task<S21Matrix> sum = SumAsync(product, S21Matrix{{1, 1}, {1, 1}});
+  S21Task<double> determinant = DeterminantAsync(sum);
+  S21Task<S21Matrix> inverse = InverseAsync(b);
+  S21Task<S21Matrix> transposed = TransposeAsync(SubAsync(sum, product));
+  ASSERT_TRUE(S21Matrix({{2, 1}, {4, 3}}) == product.Get());
+  ASSERT_TRUE(S21Matrix({{3, 2}, {5, 4}}) == sum.Get());
+  ASSERT_DOUBLE_EQ(determinant.Get(), 2);
+  ASSERT_TRUE(S21Matrix(inverse.Get()) == b.Get());
+  ASSERT_TRUE(S21Matrix({{1, 1}, {1, 1}}) == transposed.Get());
+  std::future<double> future = determinant.ToFuture();
+  ASSERT_DOUBLE_EQ(future.get(), 2);
+}
+
+TEST(async_then_and_errors, True) {
+  S21Task<int> start = S21Async([] { return 20; });
+  S21Task<int> next = start.Then([](int x) { return x + 1; }).Then([](int x) {
+    return x * 2;
+  });
+  ASSERT_EQ(next.Get(), 42);
+  S21Task<S21Matrix> bad =
+      MultiplyAsync(S21Matrix(2, 3), S21Matrix(2, 3));
+  S21Task<double> after = DeterminantAsync(bad);
+  EXPECT_ANY_THROW(after.Get());
+  EXPECT_ANY_THROW(bad.ToFuture().get());
+  S21Promise<int> promise;
+  S21Task<int> manual = promise.GetTask();
+  ASSERT_FALSE(manual.IsReady());
+  promise.SetValue(5);
+  ASSERT_TRUE(manual.IsReady());
+  EXPECT_ANY_THROW(promise.SetValue(6));
+  ASSERT_EQ(manual.Get(), 5);
+}
+
+#if defined(__cpp_impl_coroutine)
+// Собирается только в сборке C++20 (make test_cpp20)
+S21Task<S21Matrix> SquareThenAdd(S21Task<S21Matrix> input, double shift) {
+  S21Matrix a = co_await input;
+  S21Matrix square = co_await MultiplyAsync(a, a);
+  if (shift < 0) throw S21ArgumentError("Negative shift");
+  square += S21Matrix({{shift, shift}, {shift, shift}});
+  co_return square;
+}
+
+TEST(async_coroutine, True) {
+  S21Task<S21Matrix> input =
+      S21Async([] { return S21Matrix{{1, 1}, {0, 1}}; });
+  S21Task<S21Matrix> result = SquareThenAdd(input, 1);
+  ASSERT_TRUE(result.Get() == S21Matrix({{2, 3}, {1, 2}}));
+  S21Task<double> determinant = DeterminantAsync(result);
+  ASSERT_DOUBLE_EQ(determinant.Get(), 1);
+  EXPECT_THROW(SquareThenAdd(input, -1).Get(), S21ArgumentError);
+}
+#endif
+
+TEST(cache_version, True) {
+  S21Matrix a{{1, 2}, {3, 4}};
+  unsigned long long version = a.GetVersion();
+  a.GetMatrixMember(0, 0);
+  a.GetRows();
+  ASSERT_EQ(version, a.GetVersion());
+  a.SetMatrixMember(0, 0, 5);
+  ASSERT_GT(a.GetVersion(), version);
+  version = a.GetVersion();
+  a(1, 1) = 2;
+  ASSERT_GT(a.GetVersion(), version);
+  version = a.GetVersion();
+  a.SumMatrix(a);
+  ASSERT_GT(a.GetVersion(), version);
+  version = a.GetVersion();
+  a = S21Matrix{{1, 1}, {1, 1}};
+  ASSERT_GT(a.GetVersion(), version);
+  version = a.GetVersion();
+  a.MulNumber(2);
+  ASSERT_GT(a.GetVersion(), version);
+}
+
+TEST(cache_determinant_inverse, True) {
+  S21Matrix a{{2, 5, 7}, {6, 3, 4}, {5, -2, -3}};
+  ASSERT_DOUBLE_EQ(a.Determinant(), -1);
+  S21Matrix inverse = a.InverseMatrix();
+  ASSERT_GT(a.GetCache().GetBytes(), 0u);
+  S21Matrix check{{1, -1, 1}, {-38, 41, -34}, {27, -29, 24}};
+  ASSERT_TRUE(inverse == check);
+  size_t bytes = a.GetCache().GetBytes();
+  ASSERT_TRUE(a.InverseMatrix() == inverse);
+  ASSERT_EQ(bytes, a.GetCache().GetBytes());
+  a.SetMatrixMember(0, 0, 3);
+  ASSERT_DOUBLE_EQ(a.Determinant(), S21Matrix(a).Determinant());
+  ASSERT_DOUBLE_EQ(a.Determinant(), -2);
+  ASSERT_FALSE(a.InverseMatrix() == inverse);
+}
+
+TEST(determinant_inverse_large_lu, True) {
+  // Разложением по строке 12 x 12 считалось бы 12! слагаемых
+  const int n = 12;
+  S21Matrix a(n, n);
+  a.Generate([](int i, int j) { return i == j ? 2.0 : (j > i) * 0.5; });
+  S21Matrix lower(n, n);
+  lower.Generate([](int i, int j) { return i == j ? 1.0 : (j < i) * 0.25; });
+  a = Product(lower, a);
+  ASSERT_NEAR(a.Determinant(), 4096, 1e-9);
+  S21Matrix inverse = a.InverseMatrix();
+  S21Matrix identity(n, n);
+  for (int i = 0; i < n; i++) identity(i, i) = 1;
+  ASSERT_TRUE(Product(a, inverse) == identity);
+}
+
+TEST(singular_large_lu, True) {
+  // Ранг 2: ведущий элемент LU около 1e-15 вместо точного нуля
+  S21Matrix a{{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}, {13, 14, 15, 16}};
+  ASSERT_EQ(a.Determinant(), 0);
+  ASSERT_TRUE(LUDecompose(a)->singular);
+  ASSERT_THROW(a.InverseMatrix(), S21SingularError);
+  ASSERT_THROW(Solve(a, S21Matrix(4, 1)), S21SingularError);
+  ASSERT_EQ(TryInverse(a).GetStatus(), S21Status::kSingular);
+  ASSERT_EQ(TrySolve(a, S21Matrix(4, 1)).GetStatus(), S21Status::kSingular);
+  S21Matrix out;
+  ASSERT_THROW(Power(out, a, -2), S21SingularError);
+  for (int i = 0; i < 4; i++) a(i, i) += 1;
+  ASSERT_FALSE(LUDecompose(a)->singular);
+  ASSERT_NO_THROW(a.InverseMatrix());
+}
+
+TEST(cache_norms_invalidate, True) {
+  S21Matrix a{{3, -4}};
+  ASSERT_DOUBLE_EQ(FrobeniusNorm(a), 5);
+  ASSERT_DOUBLE_EQ(NormInf(a), 7);
+  ASSERT_DOUBLE_EQ(Norm1(a), 4);
+  a.GetRowData(0)[1] = 0;
+  ASSERT_DOUBLE_EQ(FrobeniusNorm(a), 3);
+  ASSERT_DOUBLE_EQ(NormInf(a), 3);
+  ASSERT_DOUBLE_EQ(Norm1(a), 3);
+}
+
+TEST(cache_limit, True) {
+  size_t limit = S21MatrixCache::GetLimit();
+  S21MatrixCache::SetLimit(40);
+  S21Matrix a{{4, 2}, {2, 3}};
+  a.InverseMatrix();
+  S21Matrix l = *CholeskyDecompose(a);
+  ASSERT_LE(a.GetCache().GetBytes(), 40u);
+  S21MatrixCache::SetLimit(0);
+  S21Matrix b{{1}};
+  b.Determinant();
+  ASSERT_EQ(b.GetCache().GetBytes(), 0u);
+  S21MatrixCache::SetLimit(limit);
+  S21Matrix check = Product(l, l.Transpose());
+  ASSERT_TRUE(check == a);
+}
+
+TEST(decompose_lu_solve, True) {
+  S21Matrix a{{0, 2, 1}, {1, 1, 1}, {2, 1, 3}};
+  std::shared_ptr<const S21LUFactors> factors = LUDecompose(a);
+  ASSERT_TRUE(LUDecompose(a) == factors);
+  ASSERT_NEAR(factors->determinant, S21Matrix(a).Determinant(), 1e-9);
+  S21Matrix b{{1, 2}, {3, 4}, {5, 6}};
+  S21Matrix x = Solve(a, b);
+  ASSERT_TRUE(Product(a, x) == b);
+  ASSERT_TRUE(Solve(a, b) == x);
+  EXPECT_ANY_THROW(Solve(S21Matrix{{1, 2}, {2, 4}}, S21Matrix(2, 1)));
+  EXPECT_ANY_THROW(CholeskyDecompose(S21Matrix{{1, 2}, {2, 1}}));
+  EXPECT_ANY_THROW(LUDecompose(S21Matrix(2, 3)));
+}
+
+TEST(allocation_aligned, True) {
+  S21Matrix a(3, 5);
+  ASSERT_EQ((uintptr_t)a.GetData() % 64, 0u);
+  ASSERT_DOUBLE_EQ(a(2, 4), 0);
+  a.AppendRows(S21Matrix(7, 5));
+  ASSERT_EQ((uintptr_t)a.GetData() % 64, 0u);
+  double *buffer = S21AllocateBuffer(0);
+  ASSERT_TRUE(buffer == nullptr);
+  S21FreeBuffer(buffer);
+}
+
+TEST(allocation_policies, True) {
+  S21AllocationPolicy saved = S21GetAllocationPolicy();
+  S21AllocationPolicy policy;
+  policy.alignment = 4096;
+  policy.map_threshold = 1 << 16;
+  S21HugePages pages[] = {S21HugePages::kNone, S21HugePages::kTransparent,
+                          S21HugePages::kExplicit};
+  S21NumaPlacement placements[] = {S21NumaPlacement::kFirstTouch,
+                                   S21NumaPlacement::kInterleave,
+                                   S21NumaPlacement::kBind};
+  for (S21HugePages huge_pages : pages) {
+    for (S21NumaPlacement placement : placements) {
+      policy.huge_pages = huge_pages;
+      policy.placement = placement;
+      S21SetAllocationPolicy(policy);
+      S21Matrix a(300, 100);
+      ASSERT_EQ((uintptr_t)a.GetData() % 4096, 0u);
+      ASSERT_DOUBLE_EQ(Sum(a), 0);
+      a.Fill(1);
+      S21Matrix b(a);
+      ASSERT_DOUBLE_EQ(Sum(b), 30000);
+    }
+  }
+  policy.alignment = 3;
+  EXPECT_ANY_THROW(S21SetAllocationPolicy(policy));
+  S21SetAllocationPolicy(saved);
+}
+
+// Диагонально доминирующая матрица: симметричная при skew == 0
+S21Matrix SolverMatrix(int n, double skew) {
+  S21Matrix a(n, n);
+  a.Generate([&](int i, int j) {
+    if (i == j) return 4.0 + i % 3;
+    if (j == i + 1) return -1.0 + skew;
+    if (i == j + 1) return -1.0 - skew;
+    if (j == i + 7 || i == j + 7) return -0.5;
+    return 0.0;
+  });
+  return a;
+}
+
+double SolverResidual(const S21Matrix &a, const S21Matrix &x,
+                      const S21Matrix &b) {
+  S21Matrix r(b.GetRows(), 1);
+  Multiply(r, a, x);
+  Sub(r, r, b);
+  return FrobeniusNorm(r) / FrobeniusNorm(b);
+}
+
+TEST(iterative_cg, True) {
+  S21Matrix a = SolverMatrix(60, 0);
+  S21Matrix b(60, 1);
+  b.Generate([](int i, int) { return 1.0 + i % 5; });
+  S21Matrix x;
+  S21SolverStats plain = SolveCG(a, b, x);
+  ASSERT_TRUE(plain.converged);
+  ASSERT_LT(SolverResidual(a, x, b), 1e-8);
+  ASSERT_EQ(plain.history.size(), (size_t)plain.iterations + 1);
+  S21JacobiPreconditioner jacobi(a);
+  S21SolverOptions options;
+  options.preconditioner = &jacobi;
+  S21Matrix y;
+  S21SolverStats stats = SolveCG(a, b, y, options);
+  ASSERT_TRUE(stats.converged);
+  ASSERT_LT(SolverResidual(a, y, b), 1e-8);
+}
+
+TEST(iterative_bicgstab_gmres, True) {
+  S21Matrix a = SolverMatrix(50, 0.4);
+  S21Matrix b(50, 1);
+  b.Generate([](int i, int) { return (i % 4) - 1.5; });
+  S21ILU0Preconditioner ilu(a);
+  S21SolverOptions options;
+  options.tolerance = 1e-10;
+  S21Matrix x;
+  ASSERT_TRUE(SolveBiCGSTAB(a, b, x, options).converged);
+  ASSERT_LT(SolverResidual(a, x, b), 1e-10);
+  options.restart = 10;
+  S21Matrix y;
+  S21SolverStats plain = SolveGMRES(a, b, y, options);
+  ASSERT_TRUE(plain.converged);
+  ASSERT_LT(SolverResidual(a, y, b), 1e-10);
+  options.preconditioner = &ilu;
+  S21Matrix z;
+  S21SolverStats stats = SolveGMRES(a, b, z, options);
+  ASSERT_TRUE(stats.converged);
+  ASSERT_LT(SolverResidual(a, z, b), 1e-10);
+  ASSERT_LT(stats.iterations, plain.iterations);
+  S21Matrix w;
+  ASSERT_TRUE(SolveBiCGSTAB(a, b, w, options).converged);
+  ASSERT_LT(SolverResidual(a, w, b), 1e-10);
+}
+
+TEST(iterative_warm_start_and_limits, True) {
+  S21Matrix a = SolverMatrix(40, 0.2);
+  S21Matrix b(40, 1);
+  b.Fill(1);
+  S21Matrix x;
+  SolveGMRES(a, b, x);
+  S21SolverStats warm = SolveGMRES(a, b, x);
+  ASSERT_TRUE(warm.converged);
+  ASSERT_EQ(warm.iterations, 0);
+  S21SolverOptions options;
+  options.max_iterations = 2;
+  S21Matrix y;
+  S21SolverStats limited = SolveBiCGSTAB(a, b, y, options);
+  ASSERT_FALSE(limited.converged);
+  ASSERT_EQ(limited.iterations, 2);
+  ASSERT_LT(limited.relative_residual, 1);
+  S21Matrix wrong(3, 1);
+  EXPECT_ANY_THROW(SolveCG(a, wrong, y));
+}
+
+TEST(iterative_function_operator, True) {
+  // Лапласиан на отрезке без явной матрицы
+  int n = 30;
+  S21FunctionOperator laplace(n, [n](const double *x, double *y) {
+    for (int i = 0; i < n; i++) {
+      y[i] = 2 * x[i] - (i > 0 ? x[i - 1] : 0) - (i + 1 < n ? x[i + 1] : 0);
+    }
+  });
+  S21Matrix b(n, 1);
+  b.Fill(1);
+  S21Matrix x;
+  S21SolverStats stats = SolveCG(laplace, b, x);
+  ASSERT_TRUE(stats.converged);
+  ASSERT_LE(stats.iterations, n);
+  for (int i = 0; i < n; i++) {
+    ASSERT_NEAR(x(i, 0), (i + 1) * (n - i) / 2.0, 1e-6);
+  }
+}
+
+// Матрица ранга rank с сингулярными числами 10, 5, 2.5, ...
+S21Matrix LowRankSample(int rows, int cols, int rank) {
+  S21Matrix result(rows, cols);
+  for (int k = 0; k < rank; k++) {
+    S21Matrix u(rows, 1), v(1, cols);
+    u.Generate([k](int i, int) { return sin((i + 1) * (k + 1) * 0.7); });
+    v.Generate([k](int, int j) { return cos((j + 2) * (k + 1) * 0.3); });
+    double scale = 10 / pow(2, k) / (FrobeniusNorm(u) * FrobeniusNorm(v));
+    S21Matrix term;
+    Multiply(term, u, v, scale);
+    Add(result, result, term);
+  }
+  return result;
+}
+
+TEST(low_rank_exact, True) {
+  S21Matrix a = LowRankSample(80, 60, 4);
+  S21LowRankOptions options;
+  options.rank = 4;
+  S21LowRankMatrix svd = RandomizedSVD(a, options);
+  ASSERT_EQ(svd.GetRows(), 80);
+  ASSERT_EQ(svd.GetCols(), 60);
+  ASSERT_EQ(svd.GetRank(), 4);
+  const std::vector<double> &values = svd.GetSingularValues();
+  for (int k = 1; k < 4; k++) ASSERT_GE(values[k - 1], values[k]);
+  S21Matrix error;
+  Sub(error, svd.ToDense(), a);
+  ASSERT_LT(FrobeniusNorm(error), 1e-9 * FrobeniusNorm(a));
+  S21Matrix identity;
+  Multiply(identity, svd.GetU(), svd.GetU(), 1, 0, true, false);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      ASSERT_NEAR(identity(i, j), i == j ? 1 : 0, 1e-10);
+    }
+  }
+  S21Matrix q = RandomizedRangeFinder(a, options);
+  ASSERT_EQ(q.GetRows(), 80);
+  ASSERT_EQ(q.GetCols(), 14);
+}
+
+TEST(low_rank_apply, True) {
+  S21Matrix a = LowRankSample(50, 40, 6);
+  S21LowRankOptions options;
+  options.rank = 6;
+  options.oversampling = 4;
+  S21LowRankMatrix svd = RandomizedSVD(a, options);
+  S21Matrix x(40, 3);
+  x.Generate([](int i, int j) { return (i * 3 + j) % 7 - 3.0; });
+  S21Matrix expected = Product(a, x);
+  S21Matrix error;
+  Sub(error, svd * x, expected);
+  ASSERT_LT(FrobeniusNorm(error), 1e-9 * FrobeniusNorm(expected));
+  S21Matrix y(2, 50);
+  y.Fill(1);
+  Sub(error, y * svd, Product(y, a));
+  ASSERT_LT(FrobeniusNorm(error), 1e-9 * FrobeniusNorm(a));
+  S21LowRankMatrix transposed = svd.Transpose();
+  ASSERT_EQ(transposed.GetRows(), 40);
+  svd.Truncate(2);
+  ASSERT_EQ(svd.GetRank(), 2);
+  ASSERT_EQ(svd.GetU().GetCols(), 2);
+  ASSERT_NEAR(svd.GetSingularValues()[1], transposed.GetSingularValues()[1],
+              1e-9);
+  options.rank = 41;
+  EXPECT_ANY_THROW(RandomizedSVD(a, options));
+  EXPECT_ANY_THROW(svd * y);
+}
+
+TEST(mult_matrix_rectangular, True) {
+  S21Matrix a = {{1, 2, 3}, {4, 5, 6}};
+  S21Matrix b = {{1}, {0}, {-1}};
+  a.MulMatrix(b);
+  ASSERT_EQ(a.GetRows(), 2);
+  ASSERT_EQ(a.GetCols(), 1);
+  ASSERT_DOUBLE_EQ(a(0, 0), -2);
+  ASSERT_DOUBLE_EQ(a(1, 0), -2);
+  S21Matrix c = S21Matrix({{1, 2}}) * S21Matrix({{3, 4, 5}, {6, 7, 8}});
+  ASSERT_TRUE(c == S21Matrix({{15, 18, 21}}));
+}
+
+TEST(vector_basics, True) {
+  S21Vector x = {1, 2, 3};
+  ASSERT_EQ(x.GetSize(), 3);
+  ASSERT_EQ((uintptr_t)x.GetData() % 64, 0u);
+  S21Vector y(x);
+  y(0) = 5;
+  ASSERT_DOUBLE_EQ(x(0), 1);
+  y.Resize(5);
+  ASSERT_DOUBLE_EQ(y(4), 0);
+  ASSERT_DOUBLE_EQ(y(2), 3);
+  S21Vector column(x.ToColumn());
+  ASSERT_TRUE(column == x);
+  ASSERT_EQ(x.ToRow().GetCols(), 3);
+  EXPECT_ANY_THROW(x(3));
+  EXPECT_ANY_THROW(S21Vector(S21Matrix(2, 2)));
+}
+
+TEST(vector_blas1, True) {
+  int n = 100003;
+  S21Vector x(n), y(n);
+  for (int i = 0; i < n; i++) {
+    x(i) = (i % 7) - 3;
+    y(i) = (i % 5) * 0.5;
+  }
+  double expected = 0;
+  for (int i = 0; i < n; i++) expected += x(i) * y(i);
+  ASSERT_NEAR(Dot(x, y), expected, 1e-9 * fabs(expected));
+  ASSERT_NEAR(Norm2(S21Vector({3, 4})), 5, 1e-12);
+  Axpy(2, x, y);
+  ASSERT_DOUBLE_EQ(y(10), (10 % 5) * 0.5 + 2 * ((10 % 7) - 3));
+  S21Vector short_vector(3);
+  EXPECT_ANY_THROW(Axpy(1, x, short_vector));
+}
+
+TEST(vector_gemv_ger, True) {
+  S21Matrix a(300, 200);
+  a.Generate([](int i, int j) { return ((i * 7 + j * 3) % 11) - 5.0; });
+  S21Vector x(200), z(300);
+  for (int i = 0; i < 200; i++) x(i) = (i % 3) - 1.0;
+  for (int i = 0; i < 300; i++) z(i) = (i % 4) * 0.25;
+  S21Vector expected(Product(a, x.ToColumn()));
+  ASSERT_TRUE(a * x == expected);
+  S21Vector y(300);
+  y.Fill(1);
+  Gemv(y, a, x, 2, 3);
+  for (int i = 0; i < 300; i++) ASSERT_DOUBLE_EQ(y(i), 2 * expected(i) + 3);
+  S21Vector transposed(Product(z.ToRow(), a));
+  ASSERT_TRUE(z * a == transposed);
+  S21Matrix check(a);
+  Ger(a, 0.5, z, x);
+  for (int i = 0; i < 300; i += 17) {
+    for (int j = 0; j < 200; j += 13) {
+      ASSERT_DOUBLE_EQ(a(i, j), check(i, j) + 0.5 * z(i) * x(j));
+    }
+  }
+  EXPECT_ANY_THROW(a * z);
+  EXPECT_ANY_THROW(Ger(a, 1, x, z));
+}
+
+TEST(shared_memory_publish_read, True) {
+  std::string name = "/s21_test_" + std::to_string(getpid());
+  S21ShmMatrix writer(name, 3, 4);
+  EXPECT_ANY_THROW(S21ShmMatrix(name, 3, 4));
+  S21ShmMatrix reader(name);
+  ASSERT_EQ(reader.GetRows(), 3);
+  ASSERT_EQ(reader.GetCols(), 4);
+  ASSERT_EQ(reader.GetSequence(), 0u);
+  S21Matrix a(3, 4);
+  a.Generate([](int i, int j) { return i * 10 + j; });
+  unsigned long long sequence = writer.Publish(a);
+  ASSERT_EQ(sequence, 2u);
+  ASSERT_EQ(reader.WaitForUpdate(0, 100), 2u);
+  ASSERT_DOUBLE_EQ(reader.GetData()[2 * 4 + 3], 23);
+  ASSERT_TRUE(reader.Validate(sequence));
+  S21Matrix copy;
+  ASSERT_EQ(reader.Read(copy), sequence);
+  ASSERT_TRUE(copy == a);
+  double *data = writer.BeginWrite();
+  ASSERT_FALSE(reader.Validate(sequence));
+  EXPECT_ANY_THROW(writer.BeginWrite());
+  data[0] = -1;
+  writer.EndWrite();
+  ASSERT_FALSE(reader.Validate(sequence));
+  ASSERT_EQ(reader.WaitForUpdate(4, 1), 4u);
+  EXPECT_ANY_THROW(writer.Publish(S21Matrix(2, 2)));
+  S21ShmMatrix::Unlink(name);
+  ASSERT_DOUBLE_EQ(reader.GetData()[0], -1);
+  EXPECT_ANY_THROW(S21ShmMatrix reopened(name));
+}
+
+TEST(shared_memory_view, True) {
+  std::string name = "/s21_test_view_" + std::to_string(getpid());
+  S21ShmMatrix writer(name, 4, 4);
+  S21ShmMatrix reader(name);
+  S21Matrix target = writer.View();
+  writer.BeginWrite();
+  target.Generate([](int i, int j) { return i == j ? 2.0 : 0.0; });
+  writer.EndWrite();
+  unsigned long long sequence = reader.GetSequence();
+  const S21Matrix snapshot = reader.View();
+  // Элементы не скопированы: матрица смотрит прямо в сегмент
+  ASSERT_EQ(snapshot.GetData(), reader.GetData());
+  ASSERT_DOUBLE_EQ(snapshot.Determinant(), 16);
+  ASSERT_DOUBLE_EQ(Trace(snapshot), 8);
+  ASSERT_TRUE(reader.Validate(sequence));
+  S21Matrix copy = snapshot;
+  ASSERT_NE(copy.GetData(), reader.GetData());
+  ASSERT_TRUE(copy == snapshot);
+  // Рост сверх блока переносит данные в собственную память
+  target.Resize(5, 4);
+  ASSERT_NE(target.GetData(), reader.GetData());
+  ASSERT_DOUBLE_EQ(target(3, 3), 2);
+  ASSERT_DOUBLE_EQ(reader.GetData()[15], 2);
+  EXPECT_ANY_THROW(S21Matrix::View(nullptr, 2, 2, 2));
+  EXPECT_ANY_THROW(S21Matrix::View(copy.GetData(), 2, 4, 3));
+  S21ShmMatrix::Unlink(name);
+}
+
+TEST(shared_memory_between_processes, True) {
+  std::string name = "/s21_test_fork_" + std::to_string(getpid());
+  S21ShmMatrix segment(name, 100, 50);
+  pid_t child = fork();
+  if (child == 0) {
+    // Дочерний процесс подключается по имени и публикует две версии
+    int status = 0;
+    try {
+      S21ShmMatrix writer(name);
+      for (int round = 1; round <= 2; round++) {
+        double *data = writer.BeginWrite();
+        for (int i = 0; i < 100 * 50; i++) data[i] = round * i;
+        writer.EndWrite();
+      }
+    } catch (...) {
+      status = 1;
+    }
+    _exit(status);
+  }
+  int status = -1;
+  waitpid(child, &status, 0);
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(WEXITSTATUS(status), 0);
+  S21Matrix result;
+  ASSERT_EQ(segment.Read(result), 4u);
+  ASSERT_DOUBLE_EQ(result(99, 49), 2 * (99 * 50 + 49));
+  S21ShmMatrix::Unlink(name);
+}
+
+TEST(distributed_scatter_gather_transpose, True) {
+  S21Matrix a(13, 9);
+  a.Generate([](int i, int j) { return i * 100 + j; });
+  std::vector<int> processes = {1, 2, 4, 6};
+  for (int count : processes) {
+    S21RunWorkers(count, [&](S21Transport &transport) {
+      S21DistributedMatrix da = S21DistributedMatrix::Scatter(
+          transport, transport.GetRank() == 0 ? a : S21Matrix(), 2);
+      if (da.GetGridRows() * da.GetGridCols() != count) {
+        throw S21StateError("Bad grid");
+      }
+      S21Matrix gathered = da.Gather();
+      S21Matrix transposed = da.Transpose().Gather();
+      if (transport.GetRank() == 0) {
+        if (!(gathered == a)) throw S21StateError("Gather failed");
+        if (!(transposed == S21Matrix(a).Transpose())) {
+          throw S21StateError("Transpose");
+        }
+      }
+    });
+  }
+}
+
+TEST(distributed_multiply, True) {
+  S21Matrix a(17, 11), b(11, 14);
+  a.Generate([](int i, int j) { return ((i * 5 + j * 3) % 7) - 3.0; });
+  b.Generate([](int i, int j) { return ((i * 2 + j) % 5) * 0.5; });
+  S21Matrix expected = Product(a, b);
+  S21RunWorkers(4, [&](S21Transport &transport) {
+    bool root = transport.GetRank() == 0;
+    S21DistributedMatrix da =
+        S21DistributedMatrix::Scatter(transport, root ? a : S21Matrix(), 3);
+    S21DistributedMatrix db =
+        S21DistributedMatrix::Scatter(transport, root ? b : S21Matrix(), 3);
+    S21DistributedMatrix dc(transport, 1, 1, 3);
+    Multiply(dc, da, db);
+    if (dc.Owner(16, 13) != (16 / 3 % 2) * 2 + 13 / 3 % 2) {
+      throw S21StateError("Owner");
+    }
+    S21Matrix c = dc.Gather();
+    if (root && !(c == expected)) throw S21StateError("Multiply failed");
+    Multiply(dc, da, da.Transpose());
+  });
+  EXPECT_ANY_THROW(S21RunWorkers(3, [](S21Transport &transport) {
+    if (transport.GetRank() == 2) throw S21StateError("Worker failed");
+  }));
+}
+
+TEST(distributed_workers_use_thread_pool, True) {
+  // Пул родителя уже запущен; в дочерних процессах его потоков нет
+  ASSERT_EQ(S21Async([] { return 1; }).Get(), 1);
+  S21Matrix a(20000, 8);
+  a.Fill(1);
+  S21RunWorkers(3, [&](S21Transport &transport) {
+    S21Task<int> task = S21Async([&] { return transport.GetRank() + 1; });
+    if (task.Get() != transport.GetRank() + 1) throw S21StateError("Bad task");
+    S21Matrix sums;
+    RowSums(sums, a);
+    if (sums(19999, 0) != 8) throw S21StateError("Bad sums");
+  });
+}
+
+TEST(tuning_blocked_multiply_matches_naive, True) {
+  S21TuningParameters saved = S21GetTuning();
+  S21Matrix a(37, 53), b(53, 29);
+  a.Generate([](int i, int j) { return sin(i * 0.3 + j * 0.7); });
+  b.Generate([](int i, int j) { return cos(i * 0.2 - j * 0.5); });
+  S21TuningParameters parameters = saved;
+  parameters.blocked_multiply_min = 1LL << 62;
+  S21SetTuning(parameters);
+  S21Matrix naive, naive_trans;
+  Multiply(naive, a, b);
+  Multiply(naive_trans, a, a, 2.0, 0.0, true, false);
+  parameters.blocked_multiply_min = 0;
+  parameters.multiply_tile = 8;
+  parameters.parallel_elements = 64;
+  S21SetTuning(parameters);
+  S21Matrix blocked, blocked_trans;
+  Multiply(blocked, a, b);
+  Multiply(blocked_trans, a, a, 2.0, 0.0, true, false);
+  for (int i = 0; i < 37; i++) {
+    for (int j = 0; j < 29; j++) ASSERT_EQ(blocked(i, j), naive(i, j));
+  }
+  ASSERT_TRUE(blocked_trans == naive_trans);
+  parameters.multiply_tile = 0;
+  EXPECT_ANY_THROW(S21SetTuning(parameters));
+  S21SetTuning(saved);
+}
+
+TEST(tuning_file_round_trip, True) {
+  S21TuningParameters saved = S21GetTuning();
+  std::string path = "/tmp/s21_tuning_" + std::to_string(getpid());
+  S21TuningParameters parameters;
+  parameters.parallel_elements = 4096;
+  parameters.multiply_tile = 32;
+  parameters.blocked_multiply_min = 12345;
+  S21SetTuning(parameters);
+  S21SaveTuning(path);
+  S21SetTuning(S21TuningParameters());
+  ASSERT_TRUE(S21LoadTuning(path));
+  ASSERT_EQ(S21GetTuning().parallel_elements, 4096);
+  ASSERT_EQ(S21GetTuning().multiply_tile, 32);
+  ASSERT_EQ(S21GetTuning().blocked_multiply_min, 12345);
+  {
+    std::ofstream file(path);
+    file << "# comment\nmultiply_tile = -3\nunknown = 7\n"
+         << "reduce_block_elements = 2048 # inline\nbroken line\n";
+  }
+  ASSERT_TRUE(S21LoadTuning(path));
+  ASSERT_EQ(S21GetTuning().multiply_tile, 32);
+  ASSERT_EQ(S21GetTuning().reduce_block_elements, 2048);
+  remove(path.c_str());
+  ASSERT_FALSE(S21LoadTuning(path));
+  S21SetTuning(saved);
+}
+
+TEST(tuning_autotune, True) {
+  S21TuningParameters saved = S21GetTuning();
+  S21AutotuneOptions options;
+  options.matrix_size = 32;
+  options.repetitions = 1;
+  S21TuningParameters tuned = S21Autotune(options);
+  ASSERT_GT(tuned.parallel_elements, 0);
+  ASSERT_GT(tuned.multiply_tile, 0);
+  // Порог всегда берется из замеренных размеров, не выше 32^3 + 1
+  ASSERT_GE(tuned.blocked_multiply_min, 8 * 8 * 8);
+  ASSERT_LE(tuned.blocked_multiply_min, 32 * 32 * 32 + 1);
+  ASSERT_EQ(S21GetTuning().multiply_tile, tuned.multiply_tile);
+  options.repetitions = 0;
+  EXPECT_ANY_THROW(S21Autotune(options));
+  S21SetTuning(saved);
+}
+
+TEST(tuning_concurrent_get_set, True) {
+  S21TuningParameters saved = S21GetTuning();
+  S21TuningParameters first = saved, second = saved;
+  first.multiply_tile = 16;
+  second.multiply_tile = 32;
+  S21SetTuning(first);
+  std::atomic<bool> done{false};
+  std::atomic<int> invalid{0};
+  std::thread reader([&] {
+    while (!done.load()) {
+      int tile = S21GetTuning().multiply_tile;
+      if (tile != 16 && tile != 32) invalid++;
+    }
+  });
+  for (int i = 0; i < 1000; i++) S21SetTuning(i % 2 ? first : second);
+  done = true;
+  reader.join();
+  ASSERT_EQ(invalid.load(), 0);
+  S21SetTuning(saved);
+}
+
+TEST(typed_exceptions, True) {
+  S21Matrix a(2, 3);
+  try {
+    a(5, 0);
+    FAIL();
+  } catch (const S21IndexError &err) {
+    ASSERT_STREQ(err.what(), "Index out of range");
+    ASSERT_EQ(err.GetStatus(), S21Status::kIndexError);
+  }
+  EXPECT_THROW(a.Determinant(), S21SizeError);
+  EXPECT_THROW(S21Matrix(0, 1), S21SizeError);
+  EXPECT_THROW(Solve(S21Matrix(2, 2), S21Matrix(2, 1)), S21SingularError);
+  EXPECT_THROW(S21ThreadPool(0), S21ArgumentError);
+  EXPECT_THROW(S21ShmMatrix("/s21_missing_segment"), S21SystemError);
+  EXPECT_THROW(a.MulMatrix(a), S21MatrixError);
+  EXPECT_THROW(a.MulMatrix(a), std::exception);
+}
+
+TEST(unchecked_access, True) {
+  S21Matrix a(3, 3);
+  unsigned long long version = a.GetVersion();
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) a.Unchecked(i, j) = i * 3 + j;
+  }
+  ASSERT_EQ(a.GetVersion(), version);
+  a.MarkModified();
+  ASSERT_GT(a.GetVersion(), version);
+  const S21Matrix &view = a;
+  ASSERT_DOUBLE_EQ(view.Unchecked(2, 1), 7);
+  ASSERT_DOUBLE_EQ(a(1, 2), 5);
+}
+
+TEST(unchecked_parallel_writes, True) {
+  const int rows = 20000;
+  S21Matrix a(rows, 4);
+  a.Fill(1);
+  ASSERT_DOUBLE_EQ(Norm1(a), rows);
+  S21ThreadPool::Instance().ParallelFor(0, rows, 512, [&](int from, int to) {
+    for (int i = from; i < to; i++) {
+      for (int j = 0; j < 4; j++) a.Unchecked(i, j) = 2;
+    }
+  });
+  a.MarkModified();
+  ASSERT_DOUBLE_EQ(Norm1(a), 2.0 * rows);
+}
+
+TEST(accessor_parallel_writes, True) {
+  const int rows = 20000;
+  S21Matrix a(rows, 4);
+  unsigned long long version = a.GetVersion();
+  S21ThreadPool::Instance().ParallelFor(0, rows, 512, [&](int from, int to) {
+    for (int i = from; i < to; i++) {
+      a(i, 0) = i;
+      a.GetRowData(i)[1] = 2 * i;
+    }
+  });
+  ASSERT_GE(a.GetVersion(), version + 2 * rows);
+  const S21Matrix &view = a;
+  ASSERT_EQ(view(rows - 1, 0), rows - 1);
+  ASSERT_EQ(view(rows - 1, 1), 2 * (rows - 1));
+}
+
+TEST(status_api, True) {
+  S21Expected<S21Matrix> created = TryCreate(0, 2);
+  ASSERT_FALSE(created);
+  ASSERT_EQ(created.GetStatus(), S21Status::kSizeError);
+  created = TryCreate(2, 2);
+  ASSERT_TRUE(created.HasValue());
+  S21Matrix &a = *created;
+  ASSERT_EQ(TrySetMember(a, 0, 0, 4), S21Status::kOk);
+  ASSERT_EQ(TrySetMember(a, 1, 1, 2), S21Status::kOk);
+  ASSERT_EQ(TrySetMember(a, 2, 0, 1), S21Status::kIndexError);
+  ASSERT_DOUBLE_EQ(TryGetMember(a, 1, 1).Value(), 2);
+  ASSERT_DOUBLE_EQ(TryGetMember(a, -1, 0).ValueOr(-7), -7);
+  ASSERT_DOUBLE_EQ(*TryDeterminant(a), 8);
+  S21Expected<S21Matrix> inverse = TryInverse(a);
+  ASSERT_TRUE(inverse);
+  ASSERT_DOUBLE_EQ(inverse->Unchecked(0, 0), 0.25);
+  ASSERT_EQ(TryInverse(S21Matrix(2, 2)).GetStatus(), S21Status::kSingular);
+  ASSERT_EQ(TryInverse(S21Matrix(2, 3)).GetStatus(), S21Status::kSizeError);
+  S21Matrix out;
+  ASSERT_EQ(TryMultiply(out, a, S21Matrix(3, 1)), S21Status::kSizeError);
+  ASSERT_EQ(TryMultiply(out, a, S21Matrix(2, 1)), S21Status::kOk);
+  ASSERT_EQ(out.GetRows(), 2);
+  ASSERT_EQ(TryAdd(out, a, S21Matrix(3, 3)), S21Status::kSizeError);
+  ASSERT_EQ(TrySub(out, a, a), S21Status::kOk);
+  ASSERT_EQ(TryResize(a, -1, 2), S21Status::kSizeError);
+  S21Matrix b = {{8}, {4}};
+  S21Expected<S21Matrix> x = TrySolve(a, b);
+  ASSERT_TRUE(x);
+  ASSERT_DOUBLE_EQ(x->Unchecked(1, 0), 2);
+  ASSERT_STREQ(S21StatusMessage(S21Status::kSingular), "Singular matrix");
+}
+
+TEST(const_read_paths, True) {
+  const S21Matrix a = {{2, 1}, {1, 3}};
+  const S21Matrix &view = a;
+  ASSERT_DOUBLE_EQ(view.Determinant(), 5);
+  ASSERT_DOUBLE_EQ(view(1, 1), 3);
+  ASSERT_DOUBLE_EQ(view.GetMatrixMember(0, 1), 1);
+  ASSERT_TRUE(view.EqMatrix(view.Transpose()));
+  ASSERT_TRUE(view == view.Transpose());
+  ASSERT_TRUE(view * view.InverseMatrix() == S21Matrix({{1, 0}, {0, 1}}));
+  ASSERT_TRUE(view + view == view * 2.0);
+  ASSERT_TRUE((view - view).EqMatrix(S21Matrix(2, 2)));
+  ASSERT_DOUBLE_EQ(view.GetMinor(1, 1)(0, 0), 3);
+  ASSERT_DOUBLE_EQ(view.CalcComplements()(0, 1), -1);
+  EXPECT_ANY_THROW(view(2, 0));
+}
+
+TEST(shared_matrix_snapshots, True) {
+  S21SharedMatrix shared(S21Matrix({{1, 2}, {3, 4}}));
+  S21SharedMatrix::Reader reader = shared.RegisterReader();
+  {
+    S21SharedMatrix::Snapshot first = reader.Acquire();
+    ASSERT_EQ(first.GetVersion(), 0u);
+    shared.Modify([](S21Matrix &m) { m(0, 0) = 10; });
+    ASSERT_EQ(shared.GetVersion(), 1u);
+    ASSERT_DOUBLE_EQ((*first)(0, 0), 1);
+    ASSERT_DOUBLE_EQ(first->Determinant(), -2);
+    S21SharedMatrix::Snapshot nested = reader.Acquire();
+    ASSERT_EQ(nested.GetVersion(), 1u);
+    ASSERT_DOUBLE_EQ((*nested)(0, 0), 10);
+    ASSERT_EQ(shared.Reclaim(), 1u);
+  }
+  ASSERT_EQ(shared.Reclaim(), 0u);
+  shared.Publish(S21Matrix(3, 3));
+  ASSERT_EQ(shared.Reclaim(), 0u);
+  ASSERT_EQ(reader.Acquire()->GetRows(), 3);
+}
+
+TEST(shared_matrix_concurrent_readers, True) {
+  S21SharedMatrix shared(S21Matrix(8, 8));
+  std::atomic<bool> done(false);
+  std::atomic<int> torn(0);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 3; t++) {
+    readers.emplace_back([&] {
+      S21SharedMatrix::Reader reader = shared.RegisterReader();
+      unsigned long long last = 0;
+      while (!done.load()) {
+        S21SharedMatrix::Snapshot snapshot = reader.Acquire();
+        double first = (*snapshot)(0, 0);
+        for (int i = 0; i < 8; i++) {
+          for (int j = 0; j < 8; j++) {
+            if ((*snapshot)(i, j) != first) torn++;
+          }
+        }
+        if (first != snapshot.GetVersion() || snapshot.GetVersion() < last) {
+          torn++;
+        }
+        last = snapshot.GetVersion();
+      }
+    });
+  }
+  for (int version = 1; version <= 300; version++) {
+    S21Matrix next(8, 8);
+    next.Fill(version);
+    shared.Publish(std::move(next));
+  }
+  done = true;
+  for (std::thread &reader : readers) reader.join();
+  shared.Synchronize();
+  ASSERT_EQ(torn.load(), 0);
+  ASSERT_EQ(shared.GetVersion(), 300u);
+}
+
+TEST(map_hadamard, True) {
+  S21Matrix a(300, 70), b(300, 70);
+  a.Generate([](int i, int j) { return i - j; });
+  b.Generate([](int i, int j) { return i + j + 1; });
+  S21Matrix out;
+  ZipMap(out, a, b, [](double x, double y) { return x * 2 + y; });
+  ASSERT_EQ(out.GetRows(), 300);
+  ASSERT_EQ(out(299, 69), (299 - 69) * 2 + 299 + 69 + 1);
+  HadamardMultiply(out, a, b);
+  ASSERT_EQ(out(10, 3), 7 * 14);
+  HadamardDivide(out, out, b);
+  ASSERT_TRUE(out == a);
+  double shift = 0.5;
+  Map(a, a, [shift](double x) { return fabs(x) + shift; });
+  ASSERT_EQ(a(0, 5), 5.5);
+  ASSERT_THROW(HadamardMultiply(out, a, S21Matrix(2, 2)), S21SizeError);
+}
+
+TEST(matrix_power, True) {
+  S21Matrix a{{1, 1, 0}, {0, 1, 2}, {1, 0, 1}};
+  S21Matrix expected = a;
+  for (int k = 1; k < 11; k++) expected = expected * a;
+  S21Matrix out;
+  Power(out, a, 11);
+  ASSERT_TRUE(out == expected);
+  Power(out, a, 0);
+  ASSERT_TRUE(out == S21Matrix({{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}));
+  Power(out, a, -3);
+  S21Matrix cube;
+  Power(cube, a, 3);
+  ASSERT_TRUE(out * cube == S21Matrix({{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}));
+  ASSERT_THROW(Power(out, S21Matrix(2, 3), 2), S21SizeError);
+  Power(out, S21Matrix(), 0);
+  ASSERT_EQ(out.GetRows(), 0);
+  ASSERT_EQ(out.GetCols(), 0);
+}
+
+TEST(matrix_exponential, True) {
+  // Нильпотентная матрица: ряд обрывается после линейного члена
+  S21Matrix out;
+  Exponential(out, S21Matrix({{0, 1e-3}, {0, 0}}));
+  ASSERT_TRUE(out == S21Matrix({{1, 1e-3}, {0, 1}}));
+  // Поворот на угол t: ветка с масштабированием и возведением в квадрат
+  for (double t : {0.1, 1.5, 20.0}) {
+    Exponential(out, S21Matrix({{0, -t}, {t, 0}}));
+    ASSERT_NEAR(out(0, 0), cos(t), 1e-12);
+    ASSERT_NEAR(out(0, 1), -sin(t), 1e-12);
+    ASSERT_NEAR(out(1, 0), sin(t), 1e-12);
+    ASSERT_NEAR(out(1, 1), cos(t), 1e-12);
+  }
+  Exponential(out, S21Matrix({{2, 0, 0}, {0, -1, 0}, {0, 0, 0.25}}));
+  ASSERT_NEAR(out(0, 0), exp(2), 1e-13);
+  ASSERT_NEAR(out(1, 1), exp(-1), 1e-15);
+  ASSERT_NEAR(out(2, 2), exp(0.25), 1e-15);
+  ASSERT_NEAR(out(0, 1), 0, 1e-15);
+}